@@ -0,0 +1,31 @@
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+/**
+ * @file cpufeatures.h
+ * @brief Run-time selection of the x86 instruction set extensions
+ *
+ * Functions using an extension are compiled for it independently of the global
+ * compiler flags and must only be called after the matching cpu_has_*() check.
+ * Defining HQC_NO_SIMD restricts the build to the portable code.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(HQC_NO_SIMD)
+#define HQC_USE_X86 /*!< x86-specific code paths are compiled in */
+
+#define PCLMUL_TARGET __attribute__((target("pclmul,sse4.1"))) /*!< 64x64-bit carry-less multiplication */
+#define VPCLMUL_TARGET __attribute__((target("vpclmulqdq,pclmul,avx2"))) /*!< 256-bit carry-less multiplication */
+#define AVX2_TARGET __attribute__((target("avx2"))) /*!< 256-bit integer vectors */
+
+#define cpu_has_pclmul() __builtin_cpu_supports("pclmul")
+#define cpu_has_vpclmul() (__builtin_cpu_supports("vpclmulqdq") && __builtin_cpu_supports("avx2"))
+#define cpu_has_avx2() __builtin_cpu_supports("avx2")
+
+#define VECTOR_ALIGN __attribute__((aligned(32))) /*!< Alignment of arrays read with 256-bit loads */
+#define SCRATCH_ALIGN __attribute__((aligned(64))) /*!< Alignment of the scratch buffers, one cache line */
+#else
+#define VECTOR_ALIGN
+#define SCRATCH_ALIGN
+#endif
+
+#endif
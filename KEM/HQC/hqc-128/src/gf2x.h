@@ -6,8 +6,42 @@
  * @brief Header file for gf2x.c
  */
 
+#include "cpufeatures.h"
+#include "parameters.h"
 #include <stdint.h>
 
-void vect_mul(uint64_t *o, const uint64_t *v1, const uint64_t *v2);
+#define SCRATCH_WORDS(n) (((n) + 7) & ~7) /*!< Size in words n rounded up to whole 64-byte lines, so that the next buffer of a scratch area stays aligned */
+#define VECT_MUL_SCRATCH_SIZE_64 (SCRATCH_WORDS((VEC_N_SIZE_64 << 1) + 1) + (VEC_N_SIZE_64 << 3)) /*!< Size in words of the scratch buffer of the multiplications */
+
+#ifdef HQC_USE_X86
+#define PCLMUL_THRESHOLD 32 /*!< Operand size in words up to which schoolbook_pclmul is used */
+#define VPCLMUL_THRESHOLD 40 /*!< Operand size in words up to which schoolbook_vpclmul is used */
+
+// Upper bound on the size in words of the Karatsuba leaves of an operand of n words with base case size t
+// (see vect_mul_prepare): the leaves of the lower half, of the upper half and of their sum, each bounded by
+// those of the lower half. Exact enough for operands of up to 64 * t words.
+#define KARATSUBA_LEAVES_0(n, t) ((n) + 3)
+#define KARATSUBA_LEAVES_1(n, t) ((n) <= (t) ? (n) + 3 : 3 * KARATSUBA_LEAVES_0(((n) + 1) / 2, t))
+#define KARATSUBA_LEAVES_2(n, t) ((n) <= (t) ? (n) + 3 : 3 * KARATSUBA_LEAVES_1(((n) + 1) / 2, t))
+#define KARATSUBA_LEAVES_3(n, t) ((n) <= (t) ? (n) + 3 : 3 * KARATSUBA_LEAVES_2(((n) + 1) / 2, t))
+#define KARATSUBA_LEAVES_4(n, t) ((n) <= (t) ? (n) + 3 : 3 * KARATSUBA_LEAVES_3(((n) + 1) / 2, t))
+#define KARATSUBA_LEAVES_5(n, t) ((n) <= (t) ? (n) + 3 : 3 * KARATSUBA_LEAVES_4(((n) + 1) / 2, t))
+#define KARATSUBA_LEAVES_6(n, t) ((n) <= (t) ? (n) + 3 : 3 * KARATSUBA_LEAVES_5(((n) + 1) / 2, t))
+
+#define VECT_MUL_PREPARED_SIZE_64 (KARATSUBA_LEAVES_6(VEC_N_SIZE_64, PCLMUL_THRESHOLD) > KARATSUBA_LEAVES_6(VEC_N_SIZE_64, VPCLMUL_THRESHOLD) ? \
+                                   KARATSUBA_LEAVES_6(VEC_N_SIZE_64, PCLMUL_THRESHOLD) : KARATSUBA_LEAVES_6(VEC_N_SIZE_64, VPCLMUL_THRESHOLD)) /*!< Size in words of an operand prepared by vect_mul_prepare */
+#define VECT_MUL_PREPARE_SCRATCH_SIZE_64 (VEC_N_SIZE_64 << 1) /*!< Size in words of the scratch buffer of vect_mul_prepare */
+#else
+#define VECT_MUL_PREPARED_SIZE_64 1 /*!< Size in words of an operand prepared by vect_mul_prepare */
+#define VECT_MUL_PREPARE_SCRATCH_SIZE_64 1 /*!< Size in words of the scratch buffer of vect_mul_prepare */
+#endif
+
+void vect_mul(uint64_t *o, const uint64_t *v1, const uint64_t *v2, uint64_t *scratch);
+void vect_mul_sparse(uint64_t *o, const uint32_t *v1, uint16_t weight, const uint64_t *v2, uint64_t *scratch);
+void vect_mul_fixed_weight(uint64_t *o, const uint64_t *v1, const uint32_t *v1_support, uint16_t weight, const uint64_t *v2, uint64_t *scratch);
+
+void vect_mul_prepare(uint64_t *p, const uint64_t *v2, uint64_t *scratch);
+void vect_mul_fixed_weight_prepared(uint64_t *o, const uint64_t *v1, const uint32_t *v1_support, uint16_t weight, const uint64_t *v2, const uint64_t *v2_prepared, uint64_t *scratch);
+void vect_mul_prepared_fixed_weight(uint64_t *o, const uint64_t *v1_prepared, const uint32_t *v1_support, uint16_t weight, const uint64_t *v2, uint64_t *scratch);
 
 #endif
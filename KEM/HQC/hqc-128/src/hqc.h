@@ -6,10 +6,53 @@
  * @brief Functions of the HQC_PKE IND_CPA scheme
  */
 
+#include "cpufeatures.h"
+#include "gf2x.h"
+#include "parameters.h"
 #include <stdint.h>
 
-void hqc_pke_keygen(unsigned char* pk, unsigned char* sk);
-void hqc_pke_encrypt(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned char *theta, const unsigned char *pk);
-void hqc_pke_decrypt(uint64_t *m, const uint64_t *u, const uint64_t *v, const unsigned char *sk);
+#define HQC_PKE_KEYGEN_SCRATCH_SIZE_64 (4 * SCRATCH_WORDS(VEC_N_SIZE_64) + VECT_MUL_SCRATCH_SIZE_64) /*!< Size in words of the scratch buffer of hqc_pke_keygen */
+#define HQC_PKE_ENCRYPT_SCRATCH_SIZE_64 (7 * SCRATCH_WORDS(VEC_N_SIZE_64) + VECT_MUL_SCRATCH_SIZE_64) /*!< Size in words of the scratch buffer of hqc_pke_encrypt and hqc_pke_encrypt_expanded */
+#define HQC_EXPAND_SCRATCH_SIZE_64 VECT_MUL_PREPARE_SCRATCH_SIZE_64 /*!< Size in words of the scratch buffer of hqc_pk_expand_ctx and hqc_sk_expand_ctx */
+#define HQC_PKE_DECRYPT_SCRATCH_SIZE_64 (4 * SCRATCH_WORDS(VEC_N_SIZE_64) + SCRATCH_WORDS(CEIL_DIVIDE(PUBLIC_KEY_BYTES, 8)) + VECT_MUL_SCRATCH_SIZE_64) /*!< Size in words of the scratch buffer of hqc_pke_decrypt and hqc_pke_decrypt_expanded */
+
+/**
+ * @brief Public key expanded by hqc_pk_expand
+ *
+ * Holds the vectors <b>h</b> and <b>s</b> along with their operands prepared by vect_mul_prepare,
+ * so that encrypting many messages to the same public key neither expands <b>h</b> from its seed
+ * nor recomputes the Karatsuba pre-additions every time.
+ */
+typedef struct hqc_expanded_pk {
+    uint64_t h[VEC_N_SIZE_64] VECTOR_ALIGN;
+    uint64_t s[VEC_N_SIZE_64] VECTOR_ALIGN;
+    uint64_t h_prepared[VECT_MUL_PREPARED_SIZE_64] VECTOR_ALIGN;
+    uint64_t s_prepared[VECT_MUL_PREPARED_SIZE_64] VECTOR_ALIGN;
+} hqc_expanded_pk;
+
+/**
+ * @brief Secret key expanded by hqc_sk_expand
+ *
+ * Holds the vector <b>y</b> in dense, sparse and prepared form, the expanded public key used for
+ * re-encryption and the public key string, so that a decapsulation only does the work depending
+ * on the ciphertext.
+ */
+typedef struct hqc_expanded_sk {
+    uint64_t y[VEC_N_SIZE_64] VECTOR_ALIGN;
+    uint32_t y_support[PARAM_OMEGA];
+    uint64_t y_prepared[VECT_MUL_PREPARED_SIZE_64] VECTOR_ALIGN;
+    hqc_expanded_pk epk;
+    uint8_t pk[PUBLIC_KEY_BYTES];
+} hqc_expanded_sk;
+
+void hqc_pke_keygen(unsigned char* pk, unsigned char* sk, uint64_t *scratch);
+void hqc_pk_expand(hqc_expanded_pk *epk, const unsigned char *pk);
+void hqc_pk_expand_ctx(hqc_expanded_pk *epk, const unsigned char *pk, void *scratch);
+void hqc_sk_expand(hqc_expanded_sk *esk, const unsigned char *sk);
+void hqc_sk_expand_ctx(hqc_expanded_sk *esk, const unsigned char *sk, void *scratch);
+void hqc_pke_encrypt(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned char *theta, const unsigned char *pk, uint64_t *scratch);
+void hqc_pke_encrypt_expanded(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned char *theta, const hqc_expanded_pk *epk, uint64_t *scratch);
+void hqc_pke_decrypt(uint64_t *m, const uint64_t *u, const uint64_t *v, const unsigned char *sk, uint64_t *scratch);
+void hqc_pke_decrypt_expanded(uint64_t *m, const uint64_t *u, const uint64_t *v, const hqc_expanded_sk *esk, uint64_t *scratch);
 
 #endif
\ No newline at end of file
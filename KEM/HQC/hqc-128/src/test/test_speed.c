@@ -8,6 +8,8 @@
 // 项目原有头文件
 #include "./api.h"
 #include "./parameters.h"
+#include "./hqc.h"
+#include "./shake_prng.h"
 #include "cpucycles.h"
 
 // 测试次数（1000次）
@@ -127,6 +129,100 @@ static double cycles_to_ms(uint64_t cycles, double cpu_freq) {
     return (double)cycles / (cpu_freq * 1000.0);
 }
 
+// 展开后的公钥/私钥（体积较大，不放在栈上）
+static hqc_expanded_pk epk;
+static hqc_expanded_sk esk;
+
+// _ctx 接口展开的公钥/私钥，与普通接口的结果逐字节比较
+static hqc_expanded_pk epk2;
+static hqc_expanded_sk esk2;
+
+// _ctx 接口的外部临时缓冲区（按接口要求 64 字节对齐）
+static unsigned char scratch[CRYPTO_SCRATCHBYTES] __attribute__((aligned(64)));
+
+// 用随机垃圾数据填充临时缓冲区，确保实现不依赖缓冲区初始内容
+static void dirty_scratch(void) {
+    for (size_t i = 0; i < CRYPTO_SCRATCHBYTES; i++) {
+        scratch[i] = (unsigned char)rand();
+    }
+}
+
+// 函数：以相同随机种子分别调用普通接口与 _ctx 接口，逐字节比较 pk/sk/ct/ss 及展开后的密钥
+// 包含篡改密文的情况（隐式拒绝路径）。返回不一致的次数
+static int check_ctx_api(int rounds) {
+    unsigned char seed[48];
+    unsigned char pk1[PUBLIC_KEY_BYTES], pk2[PUBLIC_KEY_BYTES];
+    unsigned char sk1[SECRET_KEY_BYTES], sk2[SECRET_KEY_BYTES];
+    unsigned char ct1[CIPHERTEXT_BYTES], ct2[CIPHERTEXT_BYTES];
+    unsigned char ss1[SHARED_SECRET_BYTES], ss2[SHARED_SECRET_BYTES];
+    int errors = 0;
+
+    for (int i = 0; i < rounds; i++) {
+        for (int j = 0; j < 48; j++) {
+            seed[j] = (unsigned char)rand();
+        }
+
+        // 密钥对生成
+        shake_prng_init(seed, NULL, 48, 0);
+        crypto_kem_keypair(pk1, sk1);
+        shake_prng_init(seed, NULL, 48, 0);
+        dirty_scratch();
+        crypto_kem_keypair_ctx(pk2, sk2, scratch);
+        errors += memcmp(pk1, pk2, PUBLIC_KEY_BYTES) != 0;
+        errors += memcmp(sk1, sk2, SECRET_KEY_BYTES) != 0;
+
+        // 加密（重新播种，使两次调用取得相同的随机数）
+        shake_prng_init(seed, NULL, 48, 0);
+        crypto_kem_enc(ct1, ss1, pk1);
+        shake_prng_init(seed, NULL, 48, 0);
+        dirty_scratch();
+        crypto_kem_enc_ctx(ct2, ss2, pk1, scratch);
+        errors += memcmp(ct1, ct2, CIPHERTEXT_BYTES) != 0;
+        errors += memcmp(ss1, ss2, SHARED_SECRET_BYTES) != 0;
+
+        // 公钥/私钥展开
+        hqc_pk_expand(&epk, pk1);
+        dirty_scratch();
+        hqc_pk_expand_ctx(&epk2, pk1, scratch);
+        errors += memcmp(&epk, &epk2, sizeof(epk)) != 0;
+        hqc_sk_expand(&esk, sk1);
+        dirty_scratch();
+        hqc_sk_expand_ctx(&esk2, sk1, scratch);
+        errors += memcmp(&esk, &esk2, sizeof(esk)) != 0;
+
+        // 加密（展开公钥）
+        shake_prng_init(seed, NULL, 48, 0);
+        crypto_kem_enc_expanded(ct2, ss2, &epk);
+        errors += memcmp(ct1, ct2, CIPHERTEXT_BYTES) != 0;
+        shake_prng_init(seed, NULL, 48, 0);
+        dirty_scratch();
+        crypto_kem_enc_expanded_ctx(ct2, ss2, &epk2, scratch);
+        errors += memcmp(ct1, ct2, CIPHERTEXT_BYTES) != 0;
+        errors += memcmp(ss1, ss2, SHARED_SECRET_BYTES) != 0;
+
+        // 解密（合法密文）
+        crypto_kem_dec(ss1, ct1, sk1);
+        dirty_scratch();
+        crypto_kem_dec_ctx(ss2, ct1, sk1, scratch);
+        errors += memcmp(ss1, ss2, SHARED_SECRET_BYTES) != 0;
+        dirty_scratch();
+        crypto_kem_dec_expanded_ctx(ss2, ct1, &esk2, scratch);
+        errors += memcmp(ss1, ss2, SHARED_SECRET_BYTES) != 0;
+
+        // 解密（篡改密文，隐式拒绝）
+        ct1[rand() % CIPHERTEXT_BYTES] ^= (unsigned char)(1 + rand() % 255);
+        crypto_kem_dec(ss1, ct1, sk1);
+        dirty_scratch();
+        crypto_kem_dec_ctx(ss2, ct1, sk1, scratch);
+        errors += memcmp(ss1, ss2, SHARED_SECRET_BYTES) != 0;
+        dirty_scratch();
+        crypto_kem_dec_expanded_ctx(ss2, ct1, &esk2, scratch);
+        errors += memcmp(ss1, ss2, SHARED_SECRET_BYTES) != 0;
+    }
+
+    return errors;
+}
+
 int main() {
     double cpu_freq;  // 存储CPU频率（用于后续ms换算）
     // 1. 打印平台信息（传出CPU频率）
@@ -143,11 +239,25 @@ int main() {
     uint64_t keypair_cycles[TEST_ROUNDS] = {0};
     uint64_t enc_cycles[TEST_ROUNDS] = {0};
     uint64_t dec_cycles[TEST_ROUNDS] = {0};
+    uint64_t enc_x_cycles[TEST_ROUNDS] = {0};
+    uint64_t dec_x_cycles[TEST_ROUNDS] = {0};
 
     // 4. 预热测试（避免CPU冷启动导致前几次结果偏差）
     crypto_kem_keypair(pk, sk);
     crypto_kem_enc(ct, key1, pk);
     crypto_kem_dec(key2, ct, sk);
+    hqc_pk_expand(&epk, pk);
+    hqc_sk_expand(&esk, sk);
+    crypto_kem_enc_expanded(ct, key1, &epk);
+    crypto_kem_dec_expanded(key2, ct, &esk);
+
+    // _ctx 接口一致性检查（临时缓冲区填充垃圾数据）
+    int ctx_errors = check_ctx_api(100);
+    if (ctx_errors != 0) {
+        printf("⚠️  警告：_ctx 接口与普通接口输出不一致（%d 处）！\n\n", ctx_errors);
+    } else {
+        printf("✅ _ctx 接口与普通接口输出逐字节一致（含篡改密文）。\n\n");
+    }
 
     // 5. 执行1000次测试，记录每次耗时（周期数）
     printf("正在执行 %d 次测试...\n", TEST_ROUNDS);
@@ -171,17 +281,35 @@ int main() {
         crypto_kem_dec(key2, ct, sk);
         end = cpucycles();
         dec_cycles[i] = end - start;
+
+        // 公钥/私钥展开只需对每个密钥对执行一次，不计入耗时
+        hqc_pk_expand(&epk, pk);
+        hqc_sk_expand(&esk, sk);
+
+        // 加密计时（展开公钥）
+        start = cpucycles();
+        crypto_kem_enc_expanded(ct, key1, &epk);
+        end = cpucycles();
+        enc_x_cycles[i] = end - start;
+
+        // 解密计时（展开私钥）
+        start = cpucycles();
+        crypto_kem_dec_expanded(key2, ct, &esk);
+        end = cpucycles();
+        dec_x_cycles[i] = end - start;
     }
 
     // 6. 计算各测试项的周期统计指标
-    double kp_avg_cy, enc_avg_cy, dec_avg_cy;
-    uint64_t kp_med_cy, enc_med_cy, dec_med_cy;
-    uint64_t kp_min_cy, enc_min_cy, dec_min_cy;
-    uint64_t kp_max_cy, enc_max_cy, dec_max_cy;
+    double kp_avg_cy, enc_avg_cy, dec_avg_cy, encx_avg_cy, decx_avg_cy;
+    uint64_t kp_med_cy, enc_med_cy, dec_med_cy, encx_med_cy, decx_med_cy;
+    uint64_t kp_min_cy, enc_min_cy, dec_min_cy, encx_min_cy, decx_min_cy;
+    uint64_t kp_max_cy, enc_max_cy, dec_max_cy, encx_max_cy, decx_max_cy;
 
     calc_stats(keypair_cycles, TEST_ROUNDS, &kp_avg_cy, &kp_med_cy, &kp_min_cy, &kp_max_cy);
     calc_stats(enc_cycles, TEST_ROUNDS, &enc_avg_cy, &enc_med_cy, &enc_min_cy, &enc_max_cy);
     calc_stats(dec_cycles, TEST_ROUNDS, &dec_avg_cy, &dec_med_cy, &dec_min_cy, &dec_max_cy);
+    calc_stats(enc_x_cycles, TEST_ROUNDS, &encx_avg_cy, &encx_med_cy, &encx_min_cy, &encx_max_cy);
+    calc_stats(dec_x_cycles, TEST_ROUNDS, &decx_avg_cy, &decx_med_cy, &decx_min_cy, &decx_max_cy);
 
     // 7. 换算为ms（基于CPU频率）
     // 周期统计 → ms统计（失败时标记为-1.0）
@@ -200,6 +328,16 @@ int main() {
     double dec_min_ms = cycles_to_ms(dec_min_cy, cpu_freq);
     double dec_max_ms = cycles_to_ms(dec_max_cy, cpu_freq);
 
+    double encx_avg_ms = cycles_to_ms((uint64_t)encx_avg_cy, cpu_freq);
+    double encx_med_ms = cycles_to_ms(encx_med_cy, cpu_freq);
+    double encx_min_ms = cycles_to_ms(encx_min_cy, cpu_freq);
+    double encx_max_ms = cycles_to_ms(encx_max_cy, cpu_freq);
+
+    double decx_avg_ms = cycles_to_ms((uint64_t)decx_avg_cy, cpu_freq);
+    double decx_med_ms = cycles_to_ms(decx_med_cy, cpu_freq);
+    double decx_min_ms = cycles_to_ms(decx_min_cy, cpu_freq);
+    double decx_max_ms = cycles_to_ms(decx_max_cy, cpu_freq);
+
     // 8. 双表格打印结果（周期数表格 + ms表格）
     printf("=======================================================================\n");
     printf("                      HQC-128 性能测试结果（周期数）          \n");
@@ -213,6 +351,10 @@ int main() {
            "加密", enc_avg_cy, enc_med_cy, enc_min_cy, enc_max_cy);
     printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
            "解密", dec_avg_cy, dec_med_cy, dec_min_cy, dec_max_cy);
+    printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
+           "加密(展开公钥)", encx_avg_cy, encx_med_cy, encx_min_cy, encx_max_cy);
+    printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
+           "解密(展开私钥)", decx_avg_cy, decx_med_cy, decx_min_cy, decx_max_cy);
     printf("=======================================================================\n");
 
     // ms 表格（频率获取失败时显示 N/A）
@@ -231,6 +373,10 @@ int main() {
                "加密", enc_avg_ms, enc_med_ms, enc_min_ms, enc_max_ms);
         printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
                "解密", dec_avg_ms, dec_med_ms, dec_min_ms, dec_max_ms);
+        printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
+               "加密(展开公钥)", encx_avg_ms, encx_med_ms, encx_min_ms, encx_max_ms);
+        printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
+               "解密(展开私钥)", decx_avg_ms, decx_med_ms, decx_min_ms, decx_max_ms);
     } else {
         printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
                "密钥对生成", "N/A", "N/A", "N/A", "N/A");
@@ -238,16 +384,26 @@ int main() {
                "加密", "N/A", "N/A", "N/A", "N/A");
         printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
                "解密", "N/A", "N/A", "N/A", "N/A");
+        printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
+               "加密(展开公钥)", "N/A", "N/A", "N/A", "N/A");
+        printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
+               "解密(展开私钥)", "N/A", "N/A", "N/A", "N/A");
         printf("\n⚠️  提示：CPU频率获取失败，无法换算时间（ms）\n");
     }
     printf("=======================================================================\n");
 
+    // 展开密钥后每次调用节省的周期数（按中位数计算）
+    printf("\n每次加密节省（展开公钥）: %ld 周期\n", (long)enc_med_cy - (long)encx_med_cy);
+    printf("每次解密节省（展开私钥）: %ld 周期\n", (long)dec_med_cy - (long)decx_med_cy);
+
     // 9. 算法正确性验证（确保测试数据有效）
+    crypto_kem_enc(ct, key1, pk);
+    crypto_kem_dec_expanded(key2, ct, &esk);
     if (memcmp(key1, key2, SHARED_SECRET_BYTES) != 0) {
         printf("\n⚠️  警告：最后一次测试中，加密密钥与解密密钥不匹配！\n");
     } else {
         printf("\n✅ 最后一次测试验证：加密密钥与解密密钥匹配，算法逻辑正常。\n");
     }
 
-    return 0;
+    return ctx_errors != 0;
 }
\ No newline at end of file
@@ -6,9 +6,18 @@
 #include "shake_prng.h"
 #include "parameters.h"
 #include "vector.h"
+#include "cpufeatures.h"
 #include <stdint.h>
 #include <string.h>
 #include <stdio.h>
+#ifdef HQC_USE_X86
+#include <immintrin.h>
+#endif
+
+#ifdef HQC_USE_X86
+static uint8_t support_is_new_avx2(const uint32_t *support, size_t i);
+static void vect_set_support_avx2(uint64_t *v, const uint32_t *support, uint16_t weight);
+#endif
 
 
 /**
@@ -28,13 +37,34 @@
  * @param[in] ctx Pointer to the context of the seed expander
  */
 void vect_set_random_fixed_weight(seedexpander_state *ctx, uint64_t *v, uint16_t weight) {
-    uint32_t support[PARAM_OMEGA_R] = {0};
+    uint32_t support[PARAM_OMEGA_R];
+
+    vect_set_random_fixed_weight_sparse(ctx, v, support, weight);
+}
+
+
+
+/**
+ * @brief Generates a vector of a given Hamming weight together with its support
+ *
+ * Same as vect_set_random_fixed_weight, the positions of the set bits are additionally
+ * returned in sampling order, for use with vect_mul_sparse.
+ *
+ * @param[in] ctx Pointer to the context of the seed expander
+ * @param[out] v Pointer to an array
+ * @param[out] support Pointer to an array of <b>weight</b> positions
+ * @param[in] weight Integer that is the Hamming weight
+ */
+void vect_set_random_fixed_weight_sparse(seedexpander_state *ctx, uint64_t *v, uint32_t *support, uint16_t weight) {
     uint32_t index_tab [PARAM_OMEGA_R] = {0};
     uint64_t bit_tab [PARAM_OMEGA_R] = {0};
     size_t random_bytes_size = 3 * weight;
     uint8_t rand_bytes[3 * PARAM_OMEGA_R] = {0}; // weight is expected to be <= PARAM_OMEGA_R
     uint8_t inc;
     size_t i, j;
+#ifdef HQC_USE_X86
+    int use_avx2 = cpu_has_avx2();
+#endif
 
     i = 0;
     j = random_bytes_size;
@@ -54,14 +84,28 @@ void vect_set_random_fixed_weight(seedexpander_state *ctx, uint64_t *v, uint16_t
         support[i] = support[i] % PARAM_N;
 
         inc = 1;
-        for (size_t k = 0; k < i; k++) {
-            if (support[k] == support[i]) {
-                inc = 0;
+#ifdef HQC_USE_X86
+        if (use_avx2) {
+            inc = support_is_new_avx2(support, i);
+        } else
+#endif
+        {
+            for (size_t k = 0; k < i; k++) {
+                if (support[k] == support[i]) {
+                    inc = 0;
+                }
             }
         }
         i += inc;
     }
 
+#ifdef HQC_USE_X86
+    if (use_avx2) {
+        vect_set_support_avx2(v, support, weight);
+        return;
+    }
+#endif
+
     for (size_t i = 0; i < weight; i++) {
         index_tab[i] = support[i] >> 6;
         int32_t pos = support[i] & 0x3f;
@@ -77,9 +121,83 @@ void vect_set_random_fixed_weight(seedexpander_state *ctx, uint64_t *v, uint16_t
             uint64_t mask = -val1;
             val |= (bit_tab[j] & mask);
         }
-        v[i] |= val;
+        v[i] = val;
+    }
+}
+
+
+
+#ifdef HQC_USE_X86
+/**
+ * @brief Checks whether the last sampled position differs from all previous ones
+ *
+ * Compares support[i] with eight of the positions support[0], ..., support[i - 1] per step.
+ * Lanes past i - 1 are neither loaded nor compared.
+ *
+ * @param[in] support Pointer to the positions sampled so far
+ * @param[in] i Index of the position to check
+ * @returns 1 if support[i] is new, 0 otherwise
+ */
+AVX2_TARGET
+static uint8_t support_is_new_avx2(const uint32_t *support, size_t i) {
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i x = _mm256_set1_epi32((int32_t) support[i]);
+    __m256i acc = _mm256_setzero_si256();
+    __m256i mask, y;
+
+    for (size_t k = 0; k < i; k += 8) {
+        mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t) (i - k)), lanes);
+        y = _mm256_maskload_epi32((const int *) &support[k], mask);
+        acc = _mm256_or_si256(acc, _mm256_and_si256(mask, _mm256_cmpeq_epi32(x, y)));
+    }
+
+    return (uint8_t) _mm256_testz_si256(acc, acc);
+}
+
+
+
+/**
+ * @brief Sets the bits of a vector at the given positions
+ *
+ * Constant-time counterpart of the final loop of vect_set_random_fixed_weight_sparse: every
+ * position is compared with the indices of four words of the vector per instruction, and its bit
+ * is set in the words where the comparison matches. All the other bits of the vector are cleared.
+ *
+ * @param[out] v Pointer to an array
+ * @param[in] support Pointer to an array of <b>weight</b> positions
+ * @param[in] weight Integer that is the Hamming weight
+ */
+AVX2_TARGET
+static void vect_set_support_avx2(uint64_t *v, const uint32_t *support, uint16_t weight) {
+    int64_t index_tab[PARAM_OMEGA_R];
+    int64_t bit_tab[PARAM_OMEGA_R];
+    const __m256i four = _mm256_set1_epi64x(4);
+    __m256i idx = _mm256_setr_epi64x(0, 1, 2, 3);
+    __m256i val, mask;
+    size_t i;
+
+    for (size_t j = 0; j < weight; j++) {
+        index_tab[j] = support[j] >> 6;
+        bit_tab[j] = (int64_t) ((uint64_t) 1 << (support[j] & 0x3f));
+    }
+
+    for (i = 0; i < VEC_N_SIZE_64; i += 4) {
+        val = _mm256_setzero_si256();
+        for (size_t j = 0; j < weight; j++) {
+            mask = _mm256_cmpeq_epi64(idx, _mm256_set1_epi64x(index_tab[j]));
+            val = _mm256_or_si256(val, _mm256_and_si256(mask, _mm256_set1_epi64x(bit_tab[j])));
+        }
+
+        if (i + 4 <= VEC_N_SIZE_64) {
+            _mm256_storeu_si256((__m256i *) &v[i], val);
+        } else {
+            mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(VEC_N_SIZE_64 - i), _mm256_setr_epi64x(0, 1, 2, 3));
+            _mm256_maskstore_epi64((long long *) &v[i], mask, val);
+        }
+        idx = _mm256_add_epi64(idx, four);
     }
 }
+#endif
 
 
 
@@ -93,11 +211,7 @@ void vect_set_random_fixed_weight(seedexpander_state *ctx, uint64_t *v, uint16_t
  * @param[in] ctx Pointer to the context of the seed expander
  */
 void vect_set_random(seedexpander_state *ctx, uint64_t *v) {
-    uint8_t rand_bytes[VEC_N_SIZE_BYTES] = {0};
-
-    seedexpander(ctx, rand_bytes, VEC_N_SIZE_BYTES);
-
-    memcpy(v, rand_bytes, VEC_N_SIZE_BYTES);
+    seedexpander(ctx, (uint8_t *) v, VEC_N_SIZE_BYTES);
     v[VEC_N_SIZE_64 - 1] &= BITMASK(PARAM_N, 64);
 }
 
@@ -159,6 +273,8 @@ uint8_t vect_compare(const uint8_t *v1, const uint8_t *v2, uint32_t size) {
 /**
  * @brief Resize a vector so that it contains <b>size_o</b> bits
  *
+ * When the vector grows, the words of the output past the input are cleared.
+ *
  * @param[out] o Pointer to the output vector
  * @param[in] size_o Integer that is the size of the output vector in bits
  * @param[in] v Pointer to the input vector
@@ -180,6 +296,7 @@ void vect_resize(uint64_t *o, uint32_t size_o, const uint64_t *v, uint32_t size_
         }
     } else {
         memcpy(o, v, CEIL_DIVIDE(size_v, 8));
+        memset((uint8_t *) o + CEIL_DIVIDE(size_v, 8), 0, 8 * CEIL_DIVIDE(size_o, 64) - CEIL_DIVIDE(size_v, 8));
     }
 }
 
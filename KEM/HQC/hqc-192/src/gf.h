@@ -6,8 +6,13 @@
  * @brief Header file of gf.c
  */
 
+#include "cpufeatures.h"
+#include "parameters.h"
 #include <stddef.h>
 #include <stdint.h>
+#ifdef HQC_USE_X86
+#include <immintrin.h>
+#endif
 
 
 /**
@@ -33,4 +38,145 @@ uint16_t gf_square(uint16_t a);
 uint16_t gf_inverse(uint16_t a);
 uint16_t gf_mod(uint16_t i);
 
+
+#ifdef HQC_USE_X86
+/**
+ * Split-nibble tables of the squaring map of GF(2^8): the square of a is
+ * gf_square_table[a & 0xF] ^ gf_square_table[16 + (a >> 4)].
+ */
+static const uint8_t gf_square_table [32] = { 0, 1, 4, 5, 16, 17, 20, 21, 64, 65, 68, 69, 80, 81, 84, 85, 0, 29, 116, 105, 205, 208, 185, 164, 19, 14, 103, 122, 222, 195, 170, 183 };
+
+/**
+ * The 16 low nibbles followed by the 16 high nibbles, used to build split-nibble multiplication tables.
+ */
+static const uint8_t gf_nibbles [32] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240 };
+
+
+
+/**
+ * @brief Multiplies 32 pairs of elements of GF(2^8), one pair per byte lane.
+ *
+ * Shift-and-add over the bits of b, from the most significant one, with the reduction
+ * modulo PARAM_GF_POLY folded into every doubling of the accumulator. Constant time.
+ *
+ * @returns the lane-wise product a*b
+ * @param[in] a Vector of 32 elements of GF(2^8)
+ * @param[in] b Vector of 32 elements of GF(2^8)
+ */
+AVX2_TARGET
+static inline __m256i gf_mul_avx2(__m256i a, __m256i b) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i poly = _mm256_set1_epi8(PARAM_GF_POLY & 0xFF);
+    __m256i r = zero;
+
+    for (int i = 0; i < PARAM_M; ++i) {
+        r = _mm256_xor_si256(_mm256_add_epi8(r, r), _mm256_and_si256(_mm256_cmpgt_epi8(zero, r), poly));
+        r = _mm256_xor_si256(r, _mm256_blendv_epi8(zero, a, b));
+        b = _mm256_add_epi8(b, b);
+    }
+
+    return r;
+}
+
+
+
+/**
+ * @brief Builds the split-nibble multiplication tables of an element of GF(2^8).
+ *
+ * Both 128-bit lanes of lo receive b times 0, 1, ..., 15 and both 128-bit lanes of hi
+ * receive b times 0, 16, ..., 240, as expected by gf_mul_table_avx2.
+ *
+ * @param[out] lo Table of the products by the low nibbles
+ * @param[out] hi Table of the products by the high nibbles
+ * @param[in] b Element of GF(2^8)
+ */
+AVX2_TARGET
+static inline void gf_mul_tables_avx2(__m256i *lo, __m256i *hi, uint8_t b) {
+    __m256i t = gf_mul_avx2(_mm256_loadu_si256((const __m256i *) gf_nibbles), _mm256_set1_epi8((char) b));
+
+    *lo = _mm256_permute2x128_si256(t, t, 0x00);
+    *hi = _mm256_permute2x128_si256(t, t, 0x11);
+}
+
+
+
+/**
+ * @brief Multiplies 32 elements of GF(2^8) by the element whose tables are given.
+ *
+ * Two byte shuffles indexed by the nibbles of a, hence constant time.
+ *
+ * @returns the lane-wise product of a and the element of lo and hi
+ * @param[in] a Vector of 32 elements of GF(2^8)
+ * @param[in] lo Table of the products by the low nibbles, see gf_mul_tables_avx2
+ * @param[in] hi Table of the products by the high nibbles, see gf_mul_tables_avx2
+ */
+AVX2_TARGET
+static inline __m256i gf_mul_table_avx2(__m256i a, __m256i lo, __m256i hi) {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+
+    return _mm256_xor_si256(_mm256_shuffle_epi8(lo, _mm256_and_si256(a, mask)),
+                            _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(a, 4), mask)));
+}
+
+
+
+/**
+ * @brief Squares 32 elements of GF(2^8), using the split-nibble tables of the squaring map.
+ *
+ * @returns the lane-wise square of a
+ * @param[in] a Vector of 32 elements of GF(2^8)
+ */
+AVX2_TARGET
+static inline __m256i gf_square_avx2(__m256i a) {
+    __m256i t = _mm256_loadu_si256((const __m256i *) gf_square_table);
+
+    return gf_mul_table_avx2(a, _mm256_permute2x128_si256(t, t, 0x00), _mm256_permute2x128_si256(t, t, 0x11));
+}
+
+
+
+/**
+ * @brief Inverts 32 elements of GF(2^8), with the addition chain of gf_inverse.
+ *
+ * @returns the lane-wise inverse of a (0 in the lanes where a is 0)
+ * @param[in] a Vector of 32 elements of GF(2^8)
+ */
+AVX2_TARGET
+static inline __m256i gf_inverse_avx2(__m256i a) {
+    __m256i inv, tmp1, tmp2;
+
+    inv = gf_square_avx2(a); /* a^2 */
+    tmp1 = gf_mul_avx2(inv, a); /* a^3 */
+    inv = gf_square_avx2(inv); /* a^4 */
+    tmp2 = gf_mul_avx2(inv, tmp1); /* a^7 */
+    tmp1 = gf_mul_avx2(inv, tmp2); /* a^11 */
+    inv = gf_mul_avx2(tmp1, inv); /* a^15 */
+    inv = gf_square_avx2(inv); /* a^30 */
+    inv = gf_square_avx2(inv); /* a^60 */
+    inv = gf_square_avx2(inv); /* a^120 */
+    inv = gf_mul_avx2(inv, tmp2); /* a^127 */
+    inv = gf_square_avx2(inv); /* a^254 */
+    return inv;
+}
+
+
+
+/**
+ * @brief Adds up the 32 elements of GF(2^8) of a vector.
+ *
+ * @returns the sum of the lanes of a
+ * @param[in] a Vector of 32 elements of GF(2^8)
+ */
+AVX2_TARGET
+static inline uint8_t gf_sum_avx2(__m256i a) {
+    __m128i t = _mm_xor_si128(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+    uint64_t s = (uint64_t) _mm_cvtsi128_si64(_mm_xor_si128(t, _mm_srli_si128(t, 8)));
+
+    s ^= s >> 32;
+    s ^= s >> 16;
+    s ^= s >> 8;
+    return (uint8_t) s;
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -36,10 +36,11 @@ void hqc_secret_key_to_string(uint8_t *sk, const uint8_t *sk_seed, const uint8_t
  *
  * @param[out] x uint64_t representation of vector x
  * @param[out] y uint32_t representation of vector y
+ * @param[out] y_support Support of vector y (PARAM_OMEGA positions)
  * @param[out] pk String containing the public key
  * @param[in] sk String containing the secret key
  */
-void hqc_secret_key_from_string(uint64_t *x, uint64_t *y, uint8_t *pk, const uint8_t *sk) {
+void hqc_secret_key_from_string(uint64_t *x, uint64_t *y, uint32_t *y_support, uint8_t *pk, const uint8_t *sk) {
     seedexpander_state sk_seedexpander;
     uint8_t sk_seed[SEED_BYTES] = {0};
 
@@ -47,7 +48,7 @@ void hqc_secret_key_from_string(uint64_t *x, uint64_t *y, uint8_t *pk, const uin
     seedexpander_init(&sk_seedexpander, sk_seed, SEED_BYTES);
 
     vect_set_random_fixed_weight(&sk_seedexpander, x, PARAM_OMEGA);
-    vect_set_random_fixed_weight(&sk_seedexpander, y, PARAM_OMEGA);
+    vect_set_random_fixed_weight_sparse(&sk_seedexpander, y, y_support, PARAM_OMEGA);
     memcpy(pk, sk + SEED_BYTES, PUBLIC_KEY_BYTES);
 }
 
@@ -86,6 +87,7 @@ void hqc_public_key_from_string(uint64_t *h, uint64_t *s, const uint8_t *pk) {
     seedexpander_init(&pk_seedexpander, pk_seed, SEED_BYTES);
     vect_set_random(&pk_seedexpander, h);
 
+    s[VEC_N_SIZE_64 - 1] = 0;
     memcpy(s, pk + SEED_BYTES, VEC_N_SIZE_BYTES);
 }
 
@@ -120,7 +122,9 @@ void hqc_ciphertext_to_string(uint8_t *ct, const uint64_t *u, const uint64_t *v,
  * @param[in] ct String containing the ciphertext
  */
 void hqc_ciphertext_from_string(uint64_t *u, uint64_t *v, uint8_t *d, const uint8_t *ct) {
+    u[VEC_N_SIZE_64 - 1] = 0;
     memcpy(u, ct, VEC_N_SIZE_BYTES);
+    v[VEC_N1N2_SIZE_64 - 1] = 0;
     memcpy(v, ct + VEC_N_SIZE_BYTES, VEC_N1N2_SIZE_BYTES);
     memcpy(d, ct + VEC_N_SIZE_BYTES + VEC_N1N2_SIZE_BYTES, SHAKE256_512_BYTES);
 }
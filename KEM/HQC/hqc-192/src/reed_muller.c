@@ -5,8 +5,12 @@
 
 #include "reed_muller.h"
 #include "parameters.h"
+#include "cpufeatures.h"
 #include <stdint.h>
 #include <string.h>
+#ifdef HQC_USE_X86
+#include <immintrin.h>
+#endif
 
 // number of repeated code words
 #define MULTIPLICITY                   CEIL_DIVIDE(PARAM_N2, 128)
@@ -29,6 +33,13 @@ void hadamard(expandedCodeword *src, expandedCodeword *dst);
 void expand_and_sum(expandedCodeword *dest, codeword src[]);
 int32_t find_peaks(expandedCodeword *transform);
 
+#ifdef HQC_USE_X86
+// number of codewords decoded together, one per 16-bit lane
+#define RM_BATCH 16
+
+static void reed_muller_decode_avx2(uint64_t *msg, const uint64_t *cdw);
+#endif
+
 
 
 /**
@@ -203,6 +214,14 @@ void reed_muller_decode(uint64_t *msg, const uint64_t *cdw) {
     uint8_t *message_array = (uint8_t *) msg;
     codeword *codeArray = (codeword *) cdw;
     expandedCodeword expanded;
+
+#ifdef HQC_USE_X86
+    if (cpu_has_avx2()) {
+        reed_muller_decode_avx2(msg, cdw);
+        return;
+    }
+#endif
+
     for (size_t i = 0; i < VEC_N1_SIZE_BYTES; i++) {
         // collect the codewords
         expand_and_sum(&expanded, &codeArray[i * MULTIPLICITY]);
@@ -215,3 +234,98 @@ void reed_muller_decode(uint64_t *msg, const uint64_t *cdw) {
         message_array[i] = find_peaks(&transform);
     }
 }
+
+
+
+#ifdef HQC_USE_X86
+/**
+ * @brief Decodes the received word, RM_BATCH codewords at a time
+ *
+ * Same computation as reed_muller_decode, bit-sliced across codewords: lane j of every vector
+ * belongs to codeword j of the batch, so that expand_and_sum becomes shifts and masks of the
+ * 16-bit halves of the codeword copies, every butterfly of the Hadamard transform is a single
+ * vector addition or subtraction, and find_peaks a running lane-wise maximum.
+ * The decoded messages are identical, and all steps are constant time.
+ *
+ * @param[out] msg Array of size VEC_N1_SIZE_64 receiving the decoded message
+ * @param[in] cdw Array of size VEC_N1N2_SIZE_64 storing the received word
+ */
+AVX2_TARGET
+static void reed_muller_decode_avx2(uint64_t *msg, const uint64_t *cdw) {
+    uint8_t *message_array = (uint8_t *) msg;
+    const codeword *codeArray = (const codeword *) cdw;
+    uint16_t halves[MULTIPLICITY][8][RM_BATCH];
+    uint16_t peaks[RM_BATCH];
+    __m256i expanded[128];
+    __m256i transform[128];
+    __m256i copies[MULTIPLICITY];
+    __m256i *p1, *p2, *p3;
+    __m256i t, absolute, gt, peak_abs_value, peak_value, peak_pos;
+    const __m256i one = _mm256_set1_epi16(1);
+
+    for (size_t first = 0; first < VEC_N1_SIZE_BYTES; first += RM_BATCH) {
+        // split the copies of every codeword into 16-bit halves, one codeword per lane
+        for (size_t j = 0; j < RM_BATCH; j++) {
+            for (size_t copy = 0; copy < MULTIPLICITY; copy++) {
+                for (size_t part = 0; part < 4; part++) {
+                    uint32_t w = 0;
+                    if (first + j < VEC_N1_SIZE_BYTES) {
+                        w = codeArray[(first + j) * MULTIPLICITY + copy].u32[part];
+                    }
+                    halves[copy][2 * part][j] = (uint16_t) w;
+                    halves[copy][2 * part + 1][j] = (uint16_t) (w >> 16);
+                }
+            }
+        }
+
+        // expand and sum: bit b of half h is position 16 * h + b
+        for (size_t h = 0; h < 8; h++) {
+            for (size_t copy = 0; copy < MULTIPLICITY; copy++) {
+                copies[copy] = _mm256_loadu_si256((const __m256i *) halves[copy][h]);
+            }
+            for (int b = 0; b < 16; b++) {
+                t = _mm256_setzero_si256();
+                for (size_t copy = 0; copy < MULTIPLICITY; copy++) {
+                    t = _mm256_add_epi16(t, _mm256_and_si256(_mm256_srli_epi16(copies[copy], b), one));
+                }
+                expanded[16 * h + b] = t;
+            }
+        }
+
+        // hadamard transform, with the same passes as hadamard
+        p1 = expanded;
+        p2 = transform;
+        for (int32_t pass = 0; pass < 7; pass++) {
+            for (int32_t i = 0; i < 64; i++) {
+                p2[i] = _mm256_add_epi16(p1[2 * i], p1[2 * i + 1]);
+                p2[i + 64] = _mm256_sub_epi16(p1[2 * i], p1[2 * i + 1]);
+            }
+            p3 = p1;
+            p1 = p2;
+            p2 = p3;
+        }
+        // fix the first entry to get the half Hadamard transform
+        p1[0] = _mm256_sub_epi16(p1[0], _mm256_set1_epi16(64 * MULTIPLICITY));
+
+        // find_peaks in every lane
+        peak_abs_value = _mm256_setzero_si256();
+        peak_value = _mm256_setzero_si256();
+        peak_pos = _mm256_setzero_si256();
+        for (int32_t i = 0; i < 128; i++) {
+            t = p1[i];
+            absolute = _mm256_abs_epi16(t);
+            gt = _mm256_cmpgt_epi16(absolute, peak_abs_value);
+            peak_value = _mm256_blendv_epi8(peak_value, t, gt);
+            peak_pos = _mm256_blendv_epi8(peak_pos, _mm256_set1_epi16((int16_t) i), gt);
+            peak_abs_value = _mm256_max_epi16(peak_abs_value, absolute);
+        }
+        gt = _mm256_cmpgt_epi16(peak_value, _mm256_setzero_si256());
+        peak_pos = _mm256_or_si256(peak_pos, _mm256_and_si256(gt, _mm256_set1_epi16(128)));
+        _mm256_storeu_si256((__m256i *) peaks, peak_pos);
+
+        for (size_t j = 0; j < RM_BATCH && first + j < VEC_N1_SIZE_BYTES; j++) {
+            message_array[first + j] = (uint8_t) peaks[j];
+        }
+    }
+}
+#endif
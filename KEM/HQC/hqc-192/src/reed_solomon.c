@@ -7,9 +7,13 @@
 #include "gf.h"
 #include "reed_solomon.h"
 #include "parameters.h"
+#include "cpufeatures.h"
 #include <stdint.h>
 #include <string.h>
 #include <stdio.h>
+#ifdef HQC_USE_X86
+#include <immintrin.h>
+#endif
 #ifdef VERBOSE
 #include <stdbool.h>
 #include <stdio.h>
@@ -23,6 +27,16 @@ static void compute_z_poly(uint16_t *z, const uint16_t *sigma, const uint16_t de
 static void compute_error_values(uint16_t *error_values, const uint16_t *z, const uint8_t *error);
 static void correct_errors(uint8_t *cdw, const uint16_t *error_values);
 
+#ifdef HQC_USE_X86
+// number of 32-byte vectors holding the 2 * PARAM_DELTA syndromes
+#define SYNDROME_VECTORS CEIL_DIVIDE(2 * PARAM_DELTA, 32)
+
+static void compute_syndromes_avx2(uint16_t *syndromes, const uint8_t *cdw);
+static uint16_t compute_elp_avx2(uint16_t *sigma, const uint16_t *syndromes);
+static void compute_z_poly_avx2(uint16_t *z, const uint16_t *sigma, const uint16_t degree, const uint16_t *syndromes);
+static void compute_error_values_avx2(uint16_t *error_values, const uint16_t *z, const uint8_t *error);
+#endif
+
 
 /**
  * Returns i modulo the given modulus.
@@ -125,7 +139,14 @@ void reed_solomon_encode(uint64_t *cdw, const uint64_t *msg) {
  * @param[out] syndromes Array of size 2 * PARAM_DELTA receiving the computed syndromes
  * @param[in] cdw Array of size PARAM_N1 storing the received vector
  */
-void compute_syndromes(uint16_t *syndromes, uint8_t *cdw) {	
+void compute_syndromes(uint16_t *syndromes, uint8_t *cdw) {
+#ifdef HQC_USE_X86
+    if (cpu_has_avx2()) {
+        compute_syndromes_avx2(syndromes, cdw);
+        return;
+    }
+#endif
+
     for (size_t i = 0; i < 2 * PARAM_DELTA; ++i) {
         for (size_t j = 1; j < PARAM_N1; ++j) {
             syndromes[i] ^= gf_mul(cdw[j], alpha_ij_pow[i][j-1]);
@@ -169,6 +190,12 @@ static uint16_t compute_elp(uint16_t *sigma, const uint16_t *syndromes) {
 
     uint16_t i;
 
+#ifdef HQC_USE_X86
+    if (cpu_has_avx2()) {
+        return compute_elp_avx2(sigma, syndromes);
+    }
+#endif
+
     sigma[0] = 1;
     for (mu = 0; (mu < (2 * PARAM_DELTA)); ++mu) {
         // Save sigma in case we need it to update X_sigma_p
@@ -227,9 +254,9 @@ static uint16_t compute_elp(uint16_t *sigma, const uint16_t *syndromes) {
  * @param[in] sigma Array of 2^PARAM_FFT elements storing the error locator polynomial
  */
 static void compute_roots(uint8_t *error, uint16_t *sigma) {
-    uint16_t w[1 << PARAM_M] = {0};
+    uint8_t w[1 << PARAM_M];
 
-    fft(w, sigma, PARAM_DELTA + 1);
+    fft(w, sigma);
     fft_retrieve_error_poly(error, w);
 }
 
@@ -249,6 +276,13 @@ static void compute_z_poly(uint16_t *z, const uint16_t *sigma, const uint16_t de
     size_t i, j;
     uint16_t mask;
 
+#ifdef HQC_USE_X86
+    if (cpu_has_avx2()) {
+        compute_z_poly_avx2(z, sigma, degree, syndromes);
+        return;
+    }
+#endif
+
     z[0] = 1;
 
     for (i = 1; i < PARAM_DELTA + 1; ++i) {
@@ -294,6 +328,13 @@ static void compute_error_values(uint16_t *error_values, const uint16_t *z, cons
     uint16_t inverse;
     uint16_t inverse_power_j;
 
+#ifdef HQC_USE_X86
+    if (cpu_has_avx2()) {
+        compute_error_values_avx2(error_values, z, error);
+        return;
+    }
+#endif
+
     // Compute the beta_{j_i} page 31 of the documentation
     delta_counter = 0;
     for (size_t i = 0; i < PARAM_N1; i++) {
@@ -357,6 +398,247 @@ static void correct_errors(uint8_t *cdw, const uint16_t *error_values) {
 
 
 
+#ifdef HQC_USE_X86
+/**
+ * @brief Computes 2 * PARAM_DELTA syndromes
+ *
+ * Same result as compute_syndromes, as the product of the syndrome matrix alpha_ij_pow_columns
+ * by the received vector: every byte of cdw is turned into split-nibble multiplication tables
+ * that scale a whole column of the matrix at once. Constant time.
+ *
+ * @param[out] syndromes Array of size 2 * PARAM_DELTA receiving the computed syndromes
+ * @param[in] cdw Array of size PARAM_N1 storing the received vector
+ */
+AVX2_TARGET
+static void compute_syndromes_avx2(uint16_t *syndromes, const uint8_t *cdw) {
+    uint8_t syndrome_bytes[32 * SYNDROME_VECTORS];
+    __m256i s[SYNDROME_VECTORS];
+    __m256i lo, hi;
+
+    for (size_t k = 0; k < SYNDROME_VECTORS; ++k) {
+        s[k] = _mm256_setzero_si256();
+    }
+
+    for (size_t j = 0; j < PARAM_N1; ++j) {
+        gf_mul_tables_avx2(&lo, &hi, cdw[j]);
+        for (size_t k = 0; k < SYNDROME_VECTORS; ++k) {
+            __m256i column = _mm256_loadu_si256((const __m256i *) &alpha_ij_pow_columns[j][32 * k]);
+            s[k] = _mm256_xor_si256(s[k], gf_mul_table_avx2(column, lo, hi));
+        }
+    }
+
+    for (size_t k = 0; k < SYNDROME_VECTORS; ++k) {
+        _mm256_storeu_si256((__m256i *) &syndrome_bytes[32 * k], s[k]);
+    }
+    for (size_t i = 0; i < 2 * PARAM_DELTA; ++i) {
+        syndromes[i] = syndrome_bytes[i];
+    }
+}
+
+
+
+/**
+ * @brief Computes the error locator polynomial (ELP) sigma
+ *
+ * Same algorithm and result as compute_elp, with sigma, sigma_copy and X_sigma_p held in one vector each
+ * (coefficient i in byte lane i): the update of sigma is a single vector product, the discrepancy d
+ * a dot product with the syndromes stored in reverse order, and the multiplication of X_sigma_p by X
+ * a one-byte shift. The control flow only depends on mu, so this is constant time as well.
+ *
+ * @returns the degree of the ELP sigma
+ * @param[out] sigma Array of size (at least) PARAM_DELTA + 1 receiving the ELP
+ * @param[in] syndromes Array of size (at least) 2*PARAM_DELTA storing the syndromes
+ */
+AVX2_TARGET
+static uint16_t compute_elp_avx2(uint16_t *sigma, const uint16_t *syndromes) {
+    uint8_t reversed_syndromes[2 * PARAM_DELTA + 32] = {0};
+    uint8_t sigma_bytes[32];
+    const __m256i index = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                           16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    const __m256i coefficients = _mm256_cmpgt_epi8(_mm256_set1_epi8(PARAM_DELTA + 1), index);
+    __m256i sigma_v = _mm256_setr_epi64x(1, 0, 0, 0);
+    __m256i X_sigma_p = _mm256_setr_epi64x(1 << 8, 0, 0, 0);
+    __m256i sigma_copy, dd, t;
+    uint16_t deg_sigma = 0;
+    uint16_t deg_sigma_p = 0;
+    uint16_t deg_sigma_copy = 0;
+    uint16_t pp = (uint16_t) -1; // 2*rho
+    uint16_t d_p = 1;
+    uint16_t d = syndromes[0];
+
+    uint16_t mask1, mask2, mask12;
+    uint16_t deg_X, deg_X_sigma_p;
+    uint16_t mu;
+
+    // Lane i of the window starting at 2 * PARAM_DELTA - 2 - mu holds syndromes[mu + 1 - i], or 0 if i > mu + 1
+    for (size_t i = 0; i < 2 * PARAM_DELTA; ++i) {
+        reversed_syndromes[2 * PARAM_DELTA - 1 - i] = (uint8_t) syndromes[i];
+    }
+
+    for (mu = 0; (mu < (2 * PARAM_DELTA)); ++mu) {
+        // Save sigma in case we need it to update X_sigma_p
+        sigma_copy = sigma_v;
+        deg_sigma_copy = deg_sigma;
+
+        dd = gf_mul_avx2(_mm256_set1_epi8((char) d), gf_inverse_avx2(_mm256_set1_epi8((char) d_p)));
+        sigma_v = _mm256_xor_si256(sigma_v, gf_mul_avx2(dd, X_sigma_p));
+
+        deg_X = mu - pp;
+        deg_X_sigma_p = deg_X + deg_sigma_p;
+
+        // mask1 = 0xffff if(d != 0) and 0 otherwise
+        mask1 = -((uint16_t) - d >> 15);
+
+        // mask2 = 0xffff if(deg_X_sigma_p > deg_sigma) and 0 otherwise
+        mask2 = -((uint16_t) (deg_sigma - deg_X_sigma_p) >> 15);
+
+        // mask12 = 0xffff if the deg_sigma increased and 0 otherwise
+        mask12 = mask1 & mask2;
+        deg_sigma ^= mask12 & (deg_X_sigma_p ^ deg_sigma);
+
+        if (mu == (2 * PARAM_DELTA - 1)) {
+            break;
+        }
+
+        pp ^= mask12 & (mu ^ pp);
+        d_p ^= mask12 & (d ^ d_p);
+
+        // X_sigma_p = X * (sigma_copy or X_sigma_p), keeping the coefficients 0 to PARAM_DELTA
+        t = _mm256_blendv_epi8(X_sigma_p, sigma_copy, _mm256_set1_epi8((char) mask12));
+        t = _mm256_alignr_epi8(t, _mm256_permute2x128_si256(t, t, 0x08), 15);
+        X_sigma_p = _mm256_and_si256(t, coefficients);
+
+        deg_sigma_p ^= mask12 & (deg_sigma_copy ^ deg_sigma_p);
+
+        // sigma[0] = 1 contributes syndromes[mu + 1]
+        t = _mm256_loadu_si256((const __m256i *) &reversed_syndromes[2 * PARAM_DELTA - 2 - mu]);
+        d = gf_sum_avx2(gf_mul_avx2(sigma_v, t));
+    }
+
+    _mm256_storeu_si256((__m256i *) sigma_bytes, sigma_v);
+    for (size_t i = 0; i < PARAM_DELTA + 1; ++i) {
+        sigma[i] = sigma_bytes[i];
+    }
+
+    return deg_sigma;
+}
+
+
+
+/**
+ * @brief Computes the polynomial z(x)
+ *
+ * Same result as compute_z_poly. The convolution of sigma and the syndromes is accumulated for all
+ * the coefficients of z at once, one vector product per coefficient of sigma, against the syndromes
+ * shifted by that many lanes. Constant time.
+ *
+ * @param[out] z Array of PARAM_DELTA + 1 elements receiving the polynomial z(x)
+ * @param[in] sigma Array of 2^PARAM_FFT elements storing the error locator polynomial
+ * @param[in] degree Integer that is the degree of polynomial sigma
+ * @param[in] syndromes Array of 2 * PARAM_DELTA storing the syndromes
+ */
+AVX2_TARGET
+static void compute_z_poly_avx2(uint16_t *z, const uint16_t *sigma, const uint16_t degree, const uint16_t *syndromes) {
+    uint8_t shifted_syndromes[32 + 2 * PARAM_DELTA + 32] = {0};
+    uint8_t z_bytes[32];
+    __m256i acc;
+    uint16_t mask;
+
+    // Lane i of the window starting at 31 - j holds syndromes[i - j - 1], or 0 if i <= j
+    for (size_t i = 0; i < 2 * PARAM_DELTA; ++i) {
+        shifted_syndromes[32 + i] = (uint8_t) syndromes[i];
+    }
+
+    acc = _mm256_loadu_si256((const __m256i *) &shifted_syndromes[31]);
+    for (size_t j = 1; j < PARAM_DELTA; ++j) {
+        __m256i window = _mm256_loadu_si256((const __m256i *) &shifted_syndromes[31 - j]);
+        acc = _mm256_xor_si256(acc, gf_mul_avx2(_mm256_set1_epi8((char) sigma[j]), window));
+    }
+    _mm256_storeu_si256((__m256i *) z_bytes, acc);
+
+    z[0] = 1;
+
+    // mask = 0xffff if(degree >= 1) and 0 otherwise
+    mask = -((uint16_t) -degree >> 15);
+    z[1] = (mask & sigma[1]) ^ syndromes[0];
+
+    for (size_t i = 2; i <= PARAM_DELTA; ++i) {
+        mask = -((uint16_t) (i - degree - 1) >> 15);
+        z[i] = mask & (sigma[i] ^ z_bytes[i]);
+    }
+}
+
+
+
+/**
+ * @brief Computes the error values
+ *
+ * Same result as compute_error_values, with the error locator number beta_{j_i} and
+ * the error value e_{j_i} in byte lane i: the PARAM_DELTA evaluations of z and products of
+ * page 31 of the documentation are computed together, and both the gathering of the beta_{j_i}
+ * and the placement of the e_{j_i} select lanes with comparison masks. Constant time.
+ *
+ * @param[out] error_values Array of PARAM_DELTA elements receiving the error values
+ * @param[in] z Array of PARAM_DELTA + 1 elements storing the polynomial z(x)
+ * @param[in] error Array of 2^PARAM_M elements storing the error polynomial
+ */
+AVX2_TARGET
+static void compute_error_values_avx2(uint16_t *error_values, const uint16_t *z, const uint8_t *error) {
+    uint8_t beta_bytes[PARAM_DELTA + 32];
+    const __m256i index = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                           16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    const __m256i delta_lanes = _mm256_cmpgt_epi8(_mm256_set1_epi8(PARAM_DELTA), index);
+    const __m256i one = _mm256_set1_epi8(1);
+    __m256i beta_j = _mm256_setzero_si256();
+    __m256i inverse, inverse_power_j, tmp1, tmp2, e_j, lane;
+
+    uint16_t delta_counter;
+    uint16_t delta_real_value;
+    uint16_t mask1;
+
+    // Compute the beta_{j_i} page 31 of the documentation
+    delta_counter = 0;
+    for (size_t i = 0; i < PARAM_N1; i++) {
+        mask1 = (uint16_t) (-((int32_t)error[i]) >> 31); // error[i] != 0
+        lane = _mm256_and_si256(_mm256_cmpeq_epi8(index, _mm256_set1_epi8((char) delta_counter)), delta_lanes);
+        beta_j = _mm256_xor_si256(beta_j, _mm256_and_si256(lane, _mm256_set1_epi8((char) (mask1 & gf_exp[i]))));
+        delta_counter += mask1 & ((uint16_t) (delta_counter - PARAM_DELTA) >> 15); // delta_counter < PARAM_DELTA
+    }
+    delta_real_value = delta_counter;
+
+    // beta_bytes[i + k] = beta_j[(i + k) % PARAM_DELTA] for i, k < PARAM_DELTA
+    _mm256_storeu_si256((__m256i *) beta_bytes, beta_j);
+    _mm256_storeu_si256((__m256i *) &beta_bytes[PARAM_DELTA], beta_j);
+
+    // Compute the e_{j_i} page 31 of the documentation
+    inverse = gf_inverse_avx2(beta_j);
+    inverse_power_j = one;
+    tmp1 = one;
+    for (size_t j = 1; j <= PARAM_DELTA; ++j) {
+        inverse_power_j = gf_mul_avx2(inverse_power_j, inverse);
+        tmp1 = _mm256_xor_si256(tmp1, gf_mul_avx2(inverse_power_j, _mm256_set1_epi8((char) z[j])));
+    }
+    tmp2 = one;
+    for (size_t k = 1; k < PARAM_DELTA; ++k) {
+        __m256i beta_k = _mm256_loadu_si256((const __m256i *) &beta_bytes[k]);
+        tmp2 = gf_mul_avx2(tmp2, _mm256_xor_si256(one, gf_mul_avx2(inverse, beta_k)));
+    }
+    e_j = gf_mul_avx2(tmp1, gf_inverse_avx2(tmp2));
+    e_j = _mm256_and_si256(e_j, _mm256_cmpgt_epi8(_mm256_set1_epi8((char) delta_real_value), index)); // i < delta_real_value
+
+    // Place the delta e_{j_i} values at the right coordinates of the output vector
+    delta_counter = 0;
+    for (size_t i = 0; i < PARAM_N1; ++i) {
+        mask1 = (uint16_t) (-((int32_t)error[i]) >> 31); // error[i] != 0
+        lane = _mm256_and_si256(_mm256_cmpeq_epi8(index, _mm256_set1_epi8((char) delta_counter)), delta_lanes);
+        error_values[i] = mask1 & gf_sum_avx2(_mm256_and_si256(lane, e_j));
+        delta_counter += mask1 & ((uint16_t) (delta_counter - PARAM_DELTA) >> 15); // delta_counter < PARAM_DELTA
+    }
+}
+#endif
+
+
+
 /**
  * @brief Decodes the received word
  *
@@ -10,6 +10,7 @@
 #include <stdint.h>
 
 void vect_set_random_fixed_weight(seedexpander_state *ctx, uint64_t *v, uint16_t weight);
+void vect_set_random_fixed_weight_sparse(seedexpander_state *ctx, uint64_t *v, uint32_t *support, uint16_t weight);
 void vect_set_random(seedexpander_state *ctx, uint64_t *v);
 void vect_set_random_from_prng(uint64_t *v);
 
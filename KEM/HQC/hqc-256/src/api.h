@@ -20,4 +20,39 @@ int crypto_kem_keypair(unsigned char* pk, unsigned char* sk);
 int crypto_kem_enc(unsigned char* ct, unsigned char* ss, const unsigned char* pk);
 int crypto_kem_dec(unsigned char* ss, const unsigned char* ct, const unsigned char* sk);
 
+// Variants working in a caller-provided scratch buffer instead of the stack, for callers with small stacks.
+// The buffer holds CRYPTO_SCRATCHBYTES bytes, is aligned on 64 bytes, needs no initialisation and must not
+// be shared by concurrent calls.
+#define CRYPTO_SCRATCHBYTES                 166144
+
+int crypto_kem_keypair_ctx(unsigned char* pk, unsigned char* sk, void* scratch);
+int crypto_kem_enc_ctx(unsigned char* ct, unsigned char* ss, const unsigned char* pk, void* scratch);
+int crypto_kem_dec_ctx(unsigned char* ss, const unsigned char* ct, const unsigned char* sk, void* scratch);
+
+// Encapsulation to a public key expanded once by hqc_pk_expand, for many ciphertexts to the same recipient.
+// The expanded key holds at most CRYPTO_EXPANDEDPKBYTES bytes and is aligned on 32 bytes. Callers that do not
+// include hqc.h obtain it from aligned_alloc(32, CRYPTO_EXPANDEDPKBYTES) or posix_memalign and pass that pointer
+// as a struct hqc_expanded_pk pointer. Allocated memory has no declared type; a declared array (static, automatic
+// or a struct member) must not be used, the library writes its words with types the array does not have.
+// The _ctx variants of the expansion and of the encapsulation work in a scratch buffer as described above.
+#define CRYPTO_EXPANDEDPKBYTES              138880
+
+struct hqc_expanded_pk;
+void hqc_pk_expand(struct hqc_expanded_pk* epk, const unsigned char* pk);
+void hqc_pk_expand_ctx(struct hqc_expanded_pk* epk, const unsigned char* pk, void* scratch);
+int crypto_kem_enc_expanded(unsigned char* ct, unsigned char* ss, const struct hqc_expanded_pk* epk);
+int crypto_kem_enc_expanded_ctx(unsigned char* ct, unsigned char* ss, const struct hqc_expanded_pk* epk, void* scratch);
+
+// Decapsulation with a secret key expanded once by hqc_sk_expand. The expanded key holds at most
+// CRYPTO_EXPANDEDSKBYTES bytes and is aligned on 32 bytes. Callers that do not include hqc.h obtain it from
+// aligned_alloc(32, CRYPTO_EXPANDEDSKBYTES) or posix_memalign, never from a declared array, for the reason
+// given for the expanded public key above.
+#define CRYPTO_EXPANDEDSKBYTES              216096
+
+struct hqc_expanded_sk;
+void hqc_sk_expand(struct hqc_expanded_sk* esk, const unsigned char* sk);
+void hqc_sk_expand_ctx(struct hqc_expanded_sk* esk, const unsigned char* sk, void* scratch);
+int crypto_kem_dec_expanded(unsigned char* ss, const unsigned char* ct, const struct hqc_expanded_sk* esk);
+int crypto_kem_dec_expanded_ctx(unsigned char* ss, const unsigned char* ct, const struct hqc_expanded_sk* esk, void* scratch);
+
 #endif
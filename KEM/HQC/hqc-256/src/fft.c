@@ -6,56 +6,43 @@
  * IEEE Transactions on Information Theory 56 (2010), 6265--6272.
  * http://www.math.clemson.edu/~sgao/papers/GM10.pdf <br>
  * and includes improvements proposed by Bernstein, Chou and Schwabe here:
- * https://binary.cr.yp.to/mcbits-20130616.pdf
+ * https://binary.cr.yp.to/mcbits-20130616.pdf <br>
+ * The FFT evaluates over the Cantor basis 1, 214, 152, 146, 86, 200, 88, 230 of GF(2^8),
+ * whose elements satisfy b_i^2 + b_i = b_{i-1}: the deltas of every level are then the
+ * previous betas, the twisting step vanishes and the whole transform unrolls into an
+ * iterative network whose constants are precomputed below.
  */
 
 #include "fft.h"
 #include "gf.h"
 #include "parameters.h"
+#include "cpufeatures.h"
 #include <stdint.h>
 #include <string.h>
+#ifdef HQC_USE_X86
+#include <immintrin.h>
+#endif
 
-static void compute_fft_betas(uint16_t *betas);
-static void compute_subset_sums(uint16_t *subset_sums, const uint16_t *set, uint16_t set_size);
 static void radix(uint16_t *f0, uint16_t *f1, const uint16_t *f, uint32_t m_f);
 static void radix_big(uint16_t *f0, uint16_t *f1, const uint16_t *f, uint32_t m_f);
-static void fft_rec(uint16_t *w, uint16_t *f, size_t f_coeffs, uint8_t m, uint32_t m_f, const uint16_t *betas);
+
+#ifdef HQC_USE_X86
+static void fft_butterflies_avx2(uint8_t *w);
+#endif
 
 
 /**
- * @brief Computes the basis of betas (omitting 1) used in the additive FFT and its transpose
- *
- * @param[out] betas Array of size PARAM_M-1
+ * Gammas subset sums of the butterflies: the butterflies pairing blocks of k evaluations
+ * multiply the ith evaluation of the second block by fft_gammas_sums[k + i].
  */
-static void compute_fft_betas(uint16_t *betas) {
-    size_t i;
-    for (i = 0; i < PARAM_M - 1; ++i) {
-        betas[i] = 1 << (PARAM_M - 1 - i);
-    }
-}
-
-
+static const uint8_t fft_gammas_sums [1 << PARAM_M] = { 0, 0, 0, 214, 0, 152, 214, 78, 0, 146, 152, 10, 214, 68, 78, 220, 0, 86, 146, 196, 152, 206, 10, 92, 214, 128, 68, 18, 78, 24, 220, 138, 0, 200, 86, 158, 146, 90, 196, 12, 152, 80, 206, 6, 10, 194, 92, 148, 214, 30, 128, 72, 68, 140, 18, 218, 78, 134, 24, 208, 220, 20, 138, 66, 0, 88, 200, 144, 86, 14, 158, 198, 146, 202, 90, 2, 196, 156, 12, 84, 152, 192, 80, 8, 206, 150, 6, 94, 10, 82, 194, 154, 92, 4, 148, 204, 214, 142, 30, 70, 128, 216, 72, 16, 68, 28, 140, 212, 18, 74, 218, 130, 78, 22, 134, 222, 24, 64, 208, 136, 220, 132, 20, 76, 138, 210, 66, 26, 0, 230, 88, 190, 200, 46, 144, 118, 86, 176, 14, 232, 158, 120, 198, 32, 146, 116, 202, 44, 90, 188, 2, 228, 196, 34, 156, 122, 12, 234, 84, 178, 152, 126, 192, 38, 80, 182, 8, 238, 206, 40, 150, 112, 6, 224, 94, 184, 10, 236, 82, 180, 194, 36, 154, 124, 92, 186, 4, 226, 148, 114, 204, 42, 214, 48, 142, 104, 30, 248, 70, 160, 128, 102, 216, 62, 72, 174, 16, 246, 68, 162, 28, 250, 140, 106, 212, 50, 18, 244, 74, 172, 218, 60, 130, 100, 78, 168, 22, 240, 134, 96, 222, 56, 24, 254, 64, 166, 208, 54, 136, 110, 220, 58, 132, 98, 20, 242, 76, 170, 138, 108, 210, 52, 66, 164, 26, 252 };
 
 /**
- * @brief Computes the subset sums of the given set
- *
- * The array subset_sums is such that its ith element is
- * the subset sum of the set elements given by the binary form of i.
- *
- * @param[out] subset_sums Array of size 2^set_size receiving the subset sums
- * @param[in] set Array of set_size elements
- * @param[in] set_size Size of the array set
+ * Position in the error vector of the field element evaluated by fft at each index of its output,
+ * i.e. PARAM_GF_MUL_ORDER - log(x) modulo PARAM_GF_MUL_ORDER. The element 0 is mapped to position 0
+ * as it is never a root of the ELP.
  */
-static void compute_subset_sums(uint16_t *subset_sums, const uint16_t *set, uint16_t set_size) {
-    uint16_t i, j;
-    subset_sums[0] = 0;
-
-    for (i = 0; i < set_size; ++i) {
-        for (j = 0; j < (1 << i); ++j) {
-            subset_sums[(1 << i) + j] = set[i] ^ subset_sums[j];
-        }
-    }
-}
+static const uint8_t fft_roots_index [1 << PARAM_M] = { 0, 95, 14, 190, 59, 125, 28, 134, 36, 13, 56, 244, 118, 177, 91, 250, 102, 245, 182, 15, 236, 184, 254, 99, 72, 154, 220, 26, 228, 233, 112, 44, 238, 88, 224, 240, 201, 162, 252, 211, 144, 202, 75, 53, 229, 52, 185, 123, 204, 133, 107, 235, 188, 30, 109, 140, 124, 198, 253, 160, 217, 100, 128, 113, 170, 226, 1, 148, 179, 139, 207, 200, 248, 129, 4, 141, 29, 65, 251, 82, 153, 46, 55, 11, 206, 215, 214, 61, 31, 25, 218, 35, 121, 178, 63, 60, 221, 111, 16, 176, 156, 225, 193, 54, 227, 167, 249, 48, 147, 6, 152, 69, 68, 246, 115, 73, 203, 42, 239, 104, 33, 5, 196, 149, 116, 106, 150, 87, 0, 174, 45, 93, 232, 186, 90, 212, 66, 169, 180, 10, 209, 43, 137, 117, 136, 234, 19, 237, 163, 146, 230, 86, 132, 208, 223, 83, 151, 20, 105, 84, 187, 168, 210, 222, 47, 97, 32, 40, 9, 108, 131, 161, 57, 166, 191, 195, 17, 138, 49, 213, 39, 219, 38, 12, 199, 172, 205, 79, 71, 96, 243, 37, 85, 74, 231, 197, 142, 41, 2, 192, 143, 145, 159, 89, 103, 158, 155, 23, 34, 164, 247, 21, 58, 171, 98, 130, 241, 24, 76, 3, 78, 27, 8, 183, 119, 120, 126, 81, 242, 189, 165, 101, 62, 80, 64, 50, 94, 70, 181, 194, 51, 135, 127, 92, 114, 22, 110, 77, 18, 122, 173, 216, 157, 67, 7, 175 };
 
 
 
@@ -155,167 +142,121 @@ static void radix_big(uint16_t *f0, uint16_t *f1, const uint16_t *f, uint32_t m_
 
 
 
+#ifdef HQC_USE_X86
 /**
- * @brief Evaluates f at all subset sums of a given set
+ * @brief Runs the butterflies of the additive FFT with AVX2
  *
- * This function is a subroutine of the function fft.
+ * Same network as the portable code of fft. The levels pairing blocks of 8 and 16 evaluations
+ * are interleaved so that every multiplication works on 32 useful lanes.
  *
- * @param[out] w Array
- * @param[in] f Array
- * @param[in] f_coeffs Number of coefficients of f
- * @param[in] m Number of betas
- * @param[in] m_f Number of coefficients of f (one more than its degree)
- * @param[in] betas FFT constants
+ * @param[in,out] w Array of 2^PARAM_M evaluations of the constant polynomials, receiving the evaluations of f
  */
-static void fft_rec(uint16_t *w, uint16_t *f, size_t f_coeffs, uint8_t m, uint32_t m_f, const uint16_t *betas) {
-    uint16_t f0[1 << (PARAM_FFT - 2)] = {0};
-    uint16_t f1[1 << (PARAM_FFT - 2)] = {0};
-    uint16_t gammas[PARAM_M - 2] = {0};
-    uint16_t deltas[PARAM_M - 2] = {0};
-    uint16_t gammas_sums[1 << (PARAM_M - 2)] = {0};
-    uint16_t u[1 << (PARAM_M - 2)] = {0};
-    uint16_t v[1 << (PARAM_M - 2)] = {0};
-    uint16_t tmp[PARAM_M - (PARAM_FFT - 1)] = {0};
-
-    uint16_t beta_m_pow;
+AVX2_TARGET
+static void fft_butterflies_avx2(uint8_t *w) {
+    __m256i x[1 << (PARAM_M - 5)];
+    __m256i u, v, t, g;
     size_t i, j, k;
-    size_t x;
-
-    // Step 1
-    if (m_f == 1) {
-        for (i = 0; i < m; ++i) {
-            tmp[i] = gf_mul(betas[i], f[1]);
-        }
-
-        w[0] = f[0];
-        x = 1;
-        for (j = 0; j < m; ++j) {
-            for (k = 0; k < x; ++k) {
-                w[x + k] = w[k] ^ tmp[j];
-            }
-            x <<= 1;
-        }
 
-        return;
+    for (i = 0; i < (1 << (PARAM_M - 5)); ++i) {
+        x[i] = _mm256_loadu_si256((const __m256i *) (w + 32 * i));
     }
 
-    // Step 2: compute g
-    if (betas[m - 1] != 1) {
-        beta_m_pow = 1;
-        x = 1;
-        x <<= m_f;
-        for (i = 1; i < x; ++i) {
-            beta_m_pow = gf_mul(beta_m_pow, betas[m - 1]);
-            f[i] = gf_mul(beta_m_pow, f[i]);
-        }
+#if PARAM_FFT >= 5
+    // Blocks of 8: gather the first blocks of two vectors in u and their second blocks in v
+    g = _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i *) (fft_gammas_sums + 8)));
+    for (i = 0; i < (1 << (PARAM_M - 5)); i += 2) {
+        u = _mm256_unpacklo_epi64(x[i], x[i + 1]);
+        v = _mm256_unpackhi_epi64(x[i], x[i + 1]);
+        t = _mm256_xor_si256(u, gf_mul_avx2(g, v));
+        v = _mm256_xor_si256(t, v);
+        x[i] = _mm256_unpacklo_epi64(t, v);
+        x[i + 1] = _mm256_unpackhi_epi64(t, v);
     }
-
-    // Step 3
-    radix(f0, f1, f, m_f);
-
-    // Step 4: compute gammas and deltas
-    for (i = 0; i + 1 < m; ++i) {
-        gammas[i] = gf_mul(betas[i], gf_inverse(betas[m - 1]));
-        deltas[i] = gf_square(gammas[i]) ^ gammas[i];
+#endif
+
+    // Blocks of 16: same with 128-bit lanes
+    g = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) (fft_gammas_sums + 16)));
+    for (i = 0; i < (1 << (PARAM_M - 5)); i += 2) {
+        u = _mm256_permute2x128_si256(x[i], x[i + 1], 0x20);
+        v = _mm256_permute2x128_si256(x[i], x[i + 1], 0x31);
+        t = _mm256_xor_si256(u, gf_mul_avx2(g, v));
+        v = _mm256_xor_si256(t, v);
+        x[i] = _mm256_permute2x128_si256(t, v, 0x20);
+        x[i + 1] = _mm256_permute2x128_si256(t, v, 0x31);
     }
 
-    // Compute gammas sums
-    compute_subset_sums(gammas_sums, gammas, m - 1);
-
-    // Step 5
-    fft_rec(u, f0, (f_coeffs + 1) / 2, m - 1, m_f - 1, deltas);
-
-    k = 1;
-    k <<= ((m - 1) & 0xf); // &0xf is to let the compiler know that m-1 is small.
-    if (f_coeffs <= 3) { // 3-coefficient polynomial f case: f1 is constant
-        w[0] = u[0];
-        w[k] = u[0] ^ f1[0];
-        for (i = 1; i < k; ++i) {
-            w[i] = u[i] ^ gf_mul(gammas_sums[i], f1[0]);
-            w[k + i] = w[i] ^ f1[0];
-        }
-    } else {
-        fft_rec(v, f1, f_coeffs / 2, m - 1, m_f - 1, deltas);
-
-        // Step 6
-        memcpy(w + k, v, 2 * k);
-        w[0] = u[0];
-        w[k] ^= u[0];
-        for (i = 1; i < k; ++i) {
-            w[i] = u[i] ^ gf_mul(gammas_sums[i], v[i]);
-            w[k + i] ^= w[i];
+    // Blocks of 32 and more: whole vectors
+    for (k = 1; k < (1 << (PARAM_M - 5)); k <<= 1) {
+        for (j = 0; j < k; ++j) {
+            g = _mm256_loadu_si256((const __m256i *) (fft_gammas_sums + 32 * (k + j)));
+            for (i = j; i < (1 << (PARAM_M - 5)); i += 2 * k) {
+                x[i] = _mm256_xor_si256(x[i], gf_mul_avx2(g, x[i + k]));
+                x[i + k] = _mm256_xor_si256(x[i + k], x[i]);
+            }
         }
     }
+
+    for (i = 0; i < (1 << (PARAM_M - 5)); ++i) {
+        _mm256_storeu_si256((__m256i *) (w + 32 * i), x[i]);
+    }
 }
+#endif
 
 
 
 /**
  * @brief Evaluates f on all fields elements using an additive FFT algorithm
  *
- * f_coeffs is the number of coefficients of f (one less than its degree). <br>
- * The FFT proceeds recursively to evaluate f at all subset sums of a basis B. <br>
+ * The FFT evaluates f at all subset sums of the Cantor basis B. <br>
  * This implementation is based on the paper from Gao and Mateer: <br>
  * Shuhong Gao and Todd Mateer, Additive Fast Fourier Transforms over Finite Fields,
  * IEEE Transactions on Information Theory 56 (2010), 6265--6272.
  * http://www.math.clemson.edu/~sgao/papers/GM10.pdf <br>
  * and includes improvements proposed by Bernstein, Chou and Schwabe here:
  * https://binary.cr.yp.to/mcbits-20130616.pdf <br>
- * Note that on this first call (as opposed to the recursive calls to fft_rec), gammas are equal to betas,
- * meaning the first gammas subset sums are actually the subset sums of betas (except 1). <br>
- * Also note that f is altered during computation (twisted at each level).
+ * Instead of recursing, the radix conversions of all levels are done first, down to
+ * 2^PARAM_FFT constant polynomials, followed by the PARAM_FFT levels of butterflies.
+ * The evaluations come out in the order expected by fft_retrieve_error_poly.
  *
- * @param[out] w Array
+ * @param[out] w Array of 2^PARAM_M elements receiving the evaluations of f
  * @param[in] f Array of 2^PARAM_FFT elements
- * @param[in] f_coeffs Number coefficients of f (i.e. deg(f)+1)
  */
-void fft(uint16_t *w, const uint16_t *f, size_t f_coeffs) {
-    uint16_t betas[PARAM_M - 1] = {0};
-    uint16_t betas_sums[1 << (PARAM_M - 1)] = {0};
-    uint16_t f0[1 << (PARAM_FFT - 1)] = {0};
-    uint16_t f1[1 << (PARAM_FFT - 1)] = {0};
-    uint16_t deltas[PARAM_M - 1] = {0};
-    uint16_t u[1 << (PARAM_M - 1)] = {0};
-    uint16_t v[1 << (PARAM_M - 1)] = {0};
-
-    size_t i, k;
-
-    // Follows Gao and Mateer algorithm
-    compute_fft_betas(betas);
-
-    // Step 1: PARAM_FFT > 1, nothing to do
-
-    // Compute gammas sums
-    compute_subset_sums(betas_sums, betas, PARAM_M - 1);
-
-    // Step 2: beta_m = 1, nothing to do
-
-    // Step 3
-    radix(f0, f1, f, PARAM_FFT);
-
-    // Step 4: Compute deltas
-    for (i = 0; i < PARAM_M - 1; ++i) {
-        deltas[i] = gf_square(betas[i]) ^ betas[i];
+void fft(uint8_t *w, const uint16_t *f) {
+    uint16_t coeffs[1 << PARAM_FFT];
+    uint16_t tmp[1 << PARAM_FFT];
+    size_t i, j, k, n;
+
+    // Radix conversions: the polynomials of a level are the halves of those of the previous one
+    memcpy(coeffs, f, sizeof(coeffs));
+    for (i = 0; i < PARAM_FFT; ++i) {
+        n = (size_t) 1 << (PARAM_FFT - i);
+        memcpy(tmp, coeffs, sizeof(tmp));
+        for (j = 0; j < sizeof(coeffs) / sizeof(coeffs[0]); j += n) {
+            radix(coeffs + j, coeffs + j + n / 2, tmp + j, PARAM_FFT - i);
+        }
     }
 
-    // Step 5
-    fft_rec(u, f0, (f_coeffs + 1) / 2, PARAM_M - 1, PARAM_FFT - 1, deltas);
-    fft_rec(v, f1, f_coeffs / 2, PARAM_M - 1, PARAM_FFT - 1, deltas);
-
-    k = 1 << (PARAM_M - 1);
-    // Step 6, 7 and error polynomial computation
-    memcpy(w + k, v, 2 * k);
-
-    // Check if 0 is root
-    w[0] = u[0];
-
-    // Check if 1 is root
-    w[k] ^= u[0];
+    // A constant polynomial evaluates to itself on its 2^(PARAM_M - PARAM_FFT) points
+    n = (size_t) 1 << (PARAM_M - PARAM_FFT);
+    for (i = 0; i < (1 << PARAM_FFT); ++i) {
+        memset(w + i * n, (uint8_t) coeffs[i], n);
+    }
 
-    // Find other roots
-    for (i = 1; i < k; ++i) {
-        w[i] = u[i] ^ gf_mul(betas_sums[i], v[i]);
-        w[k + i] ^= w[i];
+#ifdef HQC_USE_X86
+    if (cpu_has_avx2()) {
+        fft_butterflies_avx2(w);
+        return;
+    }
+#endif
+
+    // Butterflies: w[i] = u[i] + gammas_sums[i].v[i] and w[k + i] = w[i] + v[i]
+    for (k = n; k < (1 << PARAM_M); k <<= 1) {
+        for (j = 0; j < (1 << PARAM_M); j += 2 * k) {
+            for (i = 0; i < k; ++i) {
+                w[j + i] ^= (uint8_t) gf_mul(fft_gammas_sums[k + i], w[j + k + i]);
+                w[j + k + i] ^= w[j + i];
+            }
+        }
     }
 }
 
@@ -325,27 +266,12 @@ void fft(uint16_t *w, const uint16_t *f, size_t f_coeffs) {
  * @brief Retrieves the error polynomial error from the evaluations w of the ELP (Error Locator Polynomial) on all field elements.
  *
  * @param[out] error Array with the error
- * @param[out] error_compact Array with the error in a compact form
  * @param[in] w Array of size 2^PARAM_M
  */
-void fft_retrieve_error_poly(uint8_t *error, const uint16_t *w) {
-    uint16_t gammas[PARAM_M - 1] = {0};
-    uint16_t gammas_sums[1 << (PARAM_M - 1)] = {0};
-    uint16_t k;
-    size_t i, index;
-
-    compute_fft_betas(gammas);
-    compute_subset_sums(gammas_sums, gammas, PARAM_M - 1);
-
-    k = 1 << (PARAM_M - 1);
-    error[0] ^= 1 ^ ((uint16_t) - w[0] >> 15);
-    error[0] ^= 1 ^ ((uint16_t) - w[k] >> 15);
-
-    for (i = 1; i < k; ++i) {
-        index = PARAM_GF_MUL_ORDER - gf_log[gammas_sums[i]];
-        error[index] ^= 1 ^ ((uint16_t) - w[i] >> 15);
+void fft_retrieve_error_poly(uint8_t *error, const uint8_t *w) {
+    size_t i;
 
-        index = PARAM_GF_MUL_ORDER - gf_log[gammas_sums[i] ^ 1];
-        error[index] ^= 1 ^ ((uint16_t) - w[k + i] >> 15);
+    for (i = 0; i < (1 << PARAM_M); ++i) {
+        error[fft_roots_index[i]] ^= 1 ^ ((uint16_t) - w[i] >> 15);
     }
 }
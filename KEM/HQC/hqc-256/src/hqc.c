@@ -10,6 +10,7 @@
 #include "shake_prng.h"
 #include "code.h"
 #include "vector.h"
+#include <stddef.h>
 #include <stdint.h>
 #ifdef VERBOSE
 #include <stdio.h>
@@ -26,16 +27,20 @@
  *
  * @param[out] pk String containing the public key
  * @param[out] sk String containing the secret key
+ * @param[in] scratch Scratch buffer of HQC_PKE_KEYGEN_SCRATCH_SIZE_64 words
  */
-void hqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
+void hqc_pke_keygen(unsigned char* pk, unsigned char* sk, uint64_t *scratch) {
     seedexpander_state sk_seedexpander;
     seedexpander_state pk_seedexpander;
     uint8_t sk_seed[SEED_BYTES] = {0};
     uint8_t pk_seed[SEED_BYTES] = {0};
-    uint64_t x[VEC_N_SIZE_64] = {0};
-    uint64_t y[VEC_N_SIZE_64] = {0};
-    uint64_t h[VEC_N_SIZE_64] = {0};
-    uint64_t s[VEC_N_SIZE_64] = {0};
+    uint32_t y_support[PARAM_OMEGA];
+    uint64_t *x = scratch;
+    uint64_t *y = x + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *h = y + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *s = h + SCRATCH_WORDS(VEC_N_SIZE_64);
+
+    scratch = s + SCRATCH_WORDS(VEC_N_SIZE_64);
 
     // Create seed_expanders for public key and secret key
     shake_prng(sk_seed, SEED_BYTES);
@@ -46,11 +51,11 @@ void hqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
 
     // Compute secret key
     vect_set_random_fixed_weight(&sk_seedexpander, x, PARAM_OMEGA);
-    vect_set_random_fixed_weight(&sk_seedexpander, y, PARAM_OMEGA);
+    vect_set_random_fixed_weight_sparse(&sk_seedexpander, y, y_support, PARAM_OMEGA);
 
     // Compute public key
     vect_set_random(&pk_seedexpander, h);
-    vect_mul(s, y, h);
+    vect_mul_fixed_weight(s, y, y_support, PARAM_OMEGA, h, scratch);
     vect_add(s, x, s, VEC_N_SIZE_64);
 
     // Parse keys to string
@@ -74,39 +79,115 @@ void hqc_pke_keygen(unsigned char* pk, unsigned char* sk) {
 
 
 /**
- * @brief Encryption of the HQC_PKE IND_CPA scheme
+ * @brief Expansion of a public key of the HQC_PKE IND_CPA scheme
  *
- * The cihertext is composed of vectors <b>u</b> and <b>v</b>.
+ * Retrieves <b>h</b> and <b>s</b> from the public key and prepares both for the multiplications
+ * of hqc_pke_encrypt_expanded.
+ *
+ * @param[out] epk Expanded public key
+ * @param[in] pk String containing the public key
+ */
+void hqc_pk_expand(hqc_expanded_pk *epk, const unsigned char *pk) {
+    uint64_t scratch[HQC_EXPAND_SCRATCH_SIZE_64] SCRATCH_ALIGN;
+
+    hqc_pk_expand_ctx(epk, pk, scratch);
+}
+
+
+
+/**
+ * @brief Expansion of a public key of the HQC_PKE IND_CPA scheme working in a caller-provided buffer
+ *
+ * Same as hqc_pk_expand, with the multiplication buffer placed in <b>scratch</b> instead of the stack.
+ *
+ * @param[out] epk Expanded public key
+ * @param[in] pk String containing the public key
+ * @param[in] scratch Buffer of HQC_EXPAND_SCRATCH_SIZE_64 words aligned on 64 bytes, its content is overwritten
+ */
+void hqc_pk_expand_ctx(hqc_expanded_pk *epk, const unsigned char *pk, void *scratch) {
+    hqc_public_key_from_string(epk->h, epk->s, pk);
+    vect_mul_prepare(epk->h_prepared, epk->h, scratch);
+    vect_mul_prepare(epk->s_prepared, epk->s, scratch);
+}
+
+
+
+/**
+ * @brief Expansion of a secret key of the HQC_PKE IND_CPA scheme
+ *
+ * Retrieves <b>y</b> and the public key from the secret key, prepares <b>y</b> for the
+ * multiplications of hqc_pke_decrypt_expanded and expands the public key.
+ *
+ * @param[out] esk Expanded secret key
+ * @param[in] sk String containing the secret key
+ */
+void hqc_sk_expand(hqc_expanded_sk *esk, const unsigned char *sk) {
+    uint64_t scratch[HQC_EXPAND_SCRATCH_SIZE_64] SCRATCH_ALIGN;
+
+    hqc_sk_expand_ctx(esk, sk, scratch);
+}
+
+
+
+/**
+ * @brief Expansion of a secret key of the HQC_PKE IND_CPA scheme working in a caller-provided buffer
+ *
+ * Same as hqc_sk_expand, with the multiplication buffer placed in <b>scratch</b> instead of the stack.
+ *
+ * @param[out] esk Expanded secret key
+ * @param[in] sk String containing the secret key
+ * @param[in] scratch Buffer of HQC_EXPAND_SCRATCH_SIZE_64 words aligned on 64 bytes, its content is overwritten
+ */
+void hqc_sk_expand_ctx(hqc_expanded_sk *esk, const unsigned char *sk, void *scratch) {
+    // The unused vector x is parsed into epk.h, which the expansion of the public key overwrites with h,
+    // so that no copy of it is left behind
+    hqc_secret_key_from_string(esk->epk.h, esk->y, esk->y_support, esk->pk, sk);
+    vect_mul_prepare(esk->y_prepared, esk->y, scratch);
+    hqc_pk_expand_ctx(&esk->epk, esk->pk, scratch);
+}
+
+
+
+/**
+ * @brief Encryption of the HQC_PKE IND_CPA scheme from the vectors of the public key
  *
  * @param[out] u Vector u (first part of the ciphertext)
  * @param[out] v Vector v (second part of the ciphertext)
  * @param[in] m Vector representing the message to encrypt
  * @param[in] theta Seed used to derive randomness required for encryption
- * @param[in] pk String containing the public key
+ * @param[in] h Vector h of the public key
+ * @param[in] s Vector s of the public key
+ * @param[in] h_prepared Vector h prepared by vect_mul_prepare, or NULL
+ * @param[in] s_prepared Vector s prepared by vect_mul_prepare, or NULL
+ * @param[in] scratch Scratch buffer of 5 * SCRATCH_WORDS(VEC_N_SIZE_64) + VECT_MUL_SCRATCH_SIZE_64 words
  */
-void hqc_pke_encrypt(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned char *theta, const unsigned char *pk) {
+static void hqc_pke_encrypt_vectors(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned char *theta,
+                                    const uint64_t *h, const uint64_t *s, const uint64_t *h_prepared, const uint64_t *s_prepared,
+                                    uint64_t *scratch) {
     seedexpander_state seedexpander;
-    uint64_t h[VEC_N_SIZE_64] = {0};
-    uint64_t s[VEC_N_SIZE_64] = {0};
-    uint64_t r1[VEC_N_SIZE_64] = {0};
-    uint64_t r2[VEC_N_SIZE_64] = {0};
-    uint64_t e[VEC_N_SIZE_64] = {0};
-    uint64_t tmp1[VEC_N_SIZE_64] = {0};
-    uint64_t tmp2[VEC_N_SIZE_64] = {0};
+    uint32_t r2_support[PARAM_OMEGA_R];
+    uint64_t *r1 = scratch;
+    uint64_t *r2 = r1 + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *e = r2 + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *tmp1 = e + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *tmp2 = tmp1 + SCRATCH_WORDS(VEC_N_SIZE_64);
+
+    scratch = tmp2 + SCRATCH_WORDS(VEC_N_SIZE_64);
 
     // Create seed_expander from theta
     seedexpander_init(&seedexpander, theta, SEED_BYTES);
 
-    // Retrieve h and s from public key
-    hqc_public_key_from_string(h, s, pk);
-
     // Generate r1, r2 and e
     vect_set_random_fixed_weight(&seedexpander, r1, PARAM_OMEGA_R);
-    vect_set_random_fixed_weight(&seedexpander, r2, PARAM_OMEGA_R);
+    vect_set_random_fixed_weight_sparse(&seedexpander, r2, r2_support, PARAM_OMEGA_R);
     vect_set_random_fixed_weight(&seedexpander, e, PARAM_OMEGA_E);
 
     // Compute u = r1 + r2.h
-    vect_mul(u, r2, h);
+    if (h_prepared) {
+        vect_mul_fixed_weight_prepared(u, r2, r2_support, PARAM_OMEGA_R, h, h_prepared, scratch);
+    } else {
+        vect_mul_fixed_weight(u, r2, r2_support, PARAM_OMEGA_R, h, scratch);
+    }
     vect_add(u, r1, u, VEC_N_SIZE_64);
 
     // Compute v = m.G by encoding the message
@@ -114,7 +195,11 @@ void hqc_pke_encrypt(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned
     vect_resize(tmp1, PARAM_N, v, PARAM_N1N2);
 
     // Compute v = m.G + s.r2 + e
-    vect_mul(tmp2, r2, s);
+    if (s_prepared) {
+        vect_mul_fixed_weight_prepared(tmp2, r2, r2_support, PARAM_OMEGA_R, s, s_prepared, scratch);
+    } else {
+        vect_mul_fixed_weight(tmp2, r2, r2_support, PARAM_OMEGA_R, s, scratch);
+    }
     vect_add(tmp2, e, tmp2, VEC_N_SIZE_64);
     vect_add(tmp2, tmp1, tmp2, VEC_N_SIZE_64);
     vect_resize(v, PARAM_N1N2, tmp2, PARAM_N);
@@ -134,6 +219,48 @@ void hqc_pke_encrypt(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned
 
 
 
+/**
+ * @brief Encryption of the HQC_PKE IND_CPA scheme
+ *
+ * The cihertext is composed of vectors <b>u</b> and <b>v</b>.
+ *
+ * @param[out] u Vector u (first part of the ciphertext)
+ * @param[out] v Vector v (second part of the ciphertext)
+ * @param[in] m Vector representing the message to encrypt
+ * @param[in] theta Seed used to derive randomness required for encryption
+ * @param[in] pk String containing the public key
+ * @param[in] scratch Scratch buffer of HQC_PKE_ENCRYPT_SCRATCH_SIZE_64 words
+ */
+void hqc_pke_encrypt(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned char *theta, const unsigned char *pk, uint64_t *scratch) {
+    uint64_t *h = scratch;
+    uint64_t *s = h + SCRATCH_WORDS(VEC_N_SIZE_64);
+
+    // Retrieve h and s from public key
+    hqc_public_key_from_string(h, s, pk);
+
+    hqc_pke_encrypt_vectors(u, v, m, theta, h, s, NULL, NULL, s + SCRATCH_WORDS(VEC_N_SIZE_64));
+}
+
+
+
+/**
+ * @brief Encryption of the HQC_PKE IND_CPA scheme to an expanded public key
+ *
+ * Same as hqc_pke_encrypt, with the public key already expanded by hqc_pk_expand.
+ *
+ * @param[out] u Vector u (first part of the ciphertext)
+ * @param[out] v Vector v (second part of the ciphertext)
+ * @param[in] m Vector representing the message to encrypt
+ * @param[in] theta Seed used to derive randomness required for encryption
+ * @param[in] epk Expanded public key
+ * @param[in] scratch Scratch buffer of HQC_PKE_ENCRYPT_SCRATCH_SIZE_64 words
+ */
+void hqc_pke_encrypt_expanded(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned char *theta, const hqc_expanded_pk *epk, uint64_t *scratch) {
+    hqc_pke_encrypt_vectors(u, v, m, theta, epk->h, epk->s, epk->h_prepared, epk->s_prepared, scratch);
+}
+
+
+
 /**
  * @brief Decryption of the HQC_PKE IND_CPA scheme
  *
@@ -141,20 +268,24 @@ void hqc_pke_encrypt(uint64_t *u, uint64_t *v, const uint64_t *m, const unsigned
  * @param[in] u Vector u (first part of the ciphertext)
  * @param[in] v Vector v (second part of the ciphertext)
  * @param[in] sk String containing the secret key
+ * @param[in] scratch Scratch buffer of HQC_PKE_DECRYPT_SCRATCH_SIZE_64 words
  */
-void hqc_pke_decrypt(uint64_t *m, const uint64_t *u, const uint64_t *v, const unsigned char *sk) {
-    uint64_t x[VEC_N_SIZE_64] = {0};
-    uint64_t y[VEC_N_SIZE_64] = {0};
-    uint8_t pk[PUBLIC_KEY_BYTES] = {0};
-    uint64_t tmp1[VEC_N_SIZE_64] = {0};
-    uint64_t tmp2[VEC_N_SIZE_64] = {0};
+void hqc_pke_decrypt(uint64_t *m, const uint64_t *u, const uint64_t *v, const unsigned char *sk, uint64_t *scratch) {
+    uint32_t y_support[PARAM_OMEGA];
+    uint64_t *x = scratch;
+    uint64_t *y = x + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *tmp1 = y + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *tmp2 = tmp1 + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint8_t *pk = (uint8_t *) (tmp2 + SCRATCH_WORDS(VEC_N_SIZE_64));
+
+    scratch = tmp2 + SCRATCH_WORDS(VEC_N_SIZE_64) + SCRATCH_WORDS(CEIL_DIVIDE(PUBLIC_KEY_BYTES, 8));
 
     // Retrieve x, y, pk from secret key
-    hqc_secret_key_from_string(x, y, pk, sk);
+    hqc_secret_key_from_string(x, y, y_support, pk, sk);
 
     // Compute v - u.y
     vect_resize(tmp1, PARAM_N, v, PARAM_N1N2);
-    vect_mul(tmp2, y, u);
+    vect_mul_fixed_weight(tmp2, y, y_support, PARAM_OMEGA, u, scratch);
     vect_add(tmp2, tmp1, tmp2, VEC_N_SIZE_64);
 
     #ifdef VERBOSE
@@ -167,3 +298,38 @@ void hqc_pke_decrypt(uint64_t *m, const uint64_t *u, const uint64_t *v, const un
     // Compute m by decoding v - u.y
     code_decode(m, tmp2);
 }
+
+
+
+/**
+ * @brief Decryption of the HQC_PKE IND_CPA scheme with an expanded secret key
+ *
+ * Same as hqc_pke_decrypt, with the secret key already expanded by hqc_sk_expand.
+ *
+ * @param[out] m Vector representing the decrypted message
+ * @param[in] u Vector u (first part of the ciphertext)
+ * @param[in] v Vector v (second part of the ciphertext)
+ * @param[in] esk Expanded secret key
+ * @param[in] scratch Scratch buffer of HQC_PKE_DECRYPT_SCRATCH_SIZE_64 words
+ */
+void hqc_pke_decrypt_expanded(uint64_t *m, const uint64_t *u, const uint64_t *v, const hqc_expanded_sk *esk, uint64_t *scratch) {
+    uint64_t *tmp1 = scratch;
+    uint64_t *tmp2 = tmp1 + SCRATCH_WORDS(VEC_N_SIZE_64);
+
+    scratch = tmp2 + SCRATCH_WORDS(VEC_N_SIZE_64);
+
+    // Compute v - u.y
+    vect_resize(tmp1, PARAM_N, v, PARAM_N1N2);
+    vect_mul_prepared_fixed_weight(tmp2, esk->y_prepared, esk->y_support, PARAM_OMEGA, u, scratch);
+    vect_add(tmp2, tmp1, tmp2, VEC_N_SIZE_64);
+
+    #ifdef VERBOSE
+        printf("\n\nu: "); vect_print(u, VEC_N_SIZE_BYTES);
+        printf("\n\nv: "); vect_print(v, VEC_N1N2_SIZE_BYTES);
+        printf("\n\ny: "); vect_print(esk->y, VEC_N_SIZE_BYTES);
+        printf("\n\nv - u.y: "); vect_print(tmp2, VEC_N_SIZE_BYTES);
+    #endif
+
+    // Compute m by decoding v - u.y
+    code_decode(m, tmp2);
+}
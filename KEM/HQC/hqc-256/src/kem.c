@@ -10,12 +10,34 @@
 #include "shake_ds.h"
 #include "fips202.h"
 #include "vector.h"
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 #ifdef VERBOSE
 #include <stdio.h>
 #endif
 
+#define MC_BYTES (VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES + VEC_N1N2_SIZE_BYTES) /*!< Size in bytes of the input of the shared secret derivation */
+
+#define KEM_KEYPAIR_SCRATCH_SIZE_64 HQC_PKE_KEYGEN_SCRATCH_SIZE_64 /*!< Size in words of the scratch buffer of crypto_kem_keypair_ctx */
+#define KEM_ENC_SCRATCH_SIZE_64 (SCRATCH_WORDS(VEC_N_SIZE_64) + SCRATCH_WORDS(VEC_N1N2_SIZE_64) + SCRATCH_WORDS(CEIL_DIVIDE(MC_BYTES, 8)) \
+                                 + HQC_PKE_ENCRYPT_SCRATCH_SIZE_64) /*!< Size in words of the scratch buffer of crypto_kem_enc_ctx */
+#define KEM_DEC_SCRATCH_SIZE_64 (2 * SCRATCH_WORDS(VEC_N_SIZE_64) + 2 * SCRATCH_WORDS(VEC_N1N2_SIZE_64) + SCRATCH_WORDS(CEIL_DIVIDE(MC_BYTES, 8)) \
+                                 + (HQC_PKE_ENCRYPT_SCRATCH_SIZE_64 > HQC_PKE_DECRYPT_SCRATCH_SIZE_64 ? HQC_PKE_ENCRYPT_SCRATCH_SIZE_64 : HQC_PKE_DECRYPT_SCRATCH_SIZE_64)) /*!< Size in words of the scratch buffer of crypto_kem_dec_ctx */
+
+// Fails to compile if CRYPTO_SCRATCHBYTES in api.h is too small for one of the functions
+typedef char kem_scratch_bytes_check[(8 * KEM_KEYPAIR_SCRATCH_SIZE_64 <= CRYPTO_SCRATCHBYTES
+                                      && 8 * KEM_ENC_SCRATCH_SIZE_64 <= CRYPTO_SCRATCHBYTES
+                                      && 8 * KEM_DEC_SCRATCH_SIZE_64 <= CRYPTO_SCRATCHBYTES
+                                      && 8 * HQC_EXPAND_SCRATCH_SIZE_64 <= CRYPTO_SCRATCHBYTES) ? 1 : -1];
+
+// Fails to compile if CRYPTO_EXPANDEDPKBYTES or CRYPTO_EXPANDEDSKBYTES in api.h is too small for the expanded keys
+typedef char kem_expanded_key_bytes_check[(sizeof(hqc_expanded_pk) <= CRYPTO_EXPANDEDPKBYTES
+                                           && sizeof(hqc_expanded_sk) <= CRYPTO_EXPANDEDSKBYTES) ? 1 : -1];
+
+static int kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const hqc_expanded_pk *epk, uint64_t *scratch);
+static int kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, const hqc_expanded_sk *esk, uint64_t *scratch);
+
 
 /**
  * @brief Keygen of the HQC_KEM IND_CAA2 scheme
@@ -30,11 +52,30 @@
  * @returns 0 if keygen is successful
  */
 int crypto_kem_keypair(unsigned char *pk, unsigned char *sk) {
+    uint64_t scratch[KEM_KEYPAIR_SCRATCH_SIZE_64] SCRATCH_ALIGN;
+
+    return crypto_kem_keypair_ctx(pk, sk, scratch);
+}
+
+
+
+/**
+ * @brief Keygen of the HQC_KEM IND_CAA2 scheme working in a caller-provided buffer
+ *
+ * Same as crypto_kem_keypair, with the vectors and the multiplication buffers placed in <b>scratch</b>
+ * instead of the stack.
+ *
+ * @param[out] pk String containing the public key
+ * @param[out] sk String containing the secret key
+ * @param[in] scratch Buffer of CRYPTO_SCRATCHBYTES bytes aligned on 64 bytes, its content is overwritten
+ * @returns 0 if keygen is successful
+ */
+int crypto_kem_keypair_ctx(unsigned char *pk, unsigned char *sk, void *scratch) {
     #ifdef VERBOSE
         printf("\n\n\n\n### KEYGEN ###");
     #endif
 
-    hqc_pke_keygen(pk, sk);
+    hqc_pke_keygen(pk, sk, scratch);
     return 0;
 }
 
@@ -49,18 +90,94 @@ int crypto_kem_keypair(unsigned char *pk, unsigned char *sk) {
  * @returns 0 if encapsulation is successful
  */
 int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk) {
+    uint64_t scratch[KEM_ENC_SCRATCH_SIZE_64] SCRATCH_ALIGN;
+
+    return kem_enc(ct, ss, pk, NULL, scratch);
+}
+
+
+
+/**
+ * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme working in a caller-provided buffer
+ *
+ * Same as crypto_kem_enc, with the vectors and the multiplication buffers placed in <b>scratch</b>
+ * instead of the stack.
+ *
+ * @param[out] ct String containing the ciphertext
+ * @param[out] ss String containing the shared secret
+ * @param[in] pk String containing the public key
+ * @param[in] scratch Buffer of CRYPTO_SCRATCHBYTES bytes aligned on 64 bytes, its content is overwritten
+ * @returns 0 if encapsulation is successful
+ */
+int crypto_kem_enc_ctx(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *scratch) {
+    return kem_enc(ct, ss, pk, NULL, scratch);
+}
+
+
+
+/**
+ * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme to an expanded public key
+ *
+ * Same as crypto_kem_enc, with the public key expanded beforehand by hqc_pk_expand.
+ * Expanding once and calling this function for every ciphertext avoids retrieving the public key
+ * vectors again when many ciphertexts are sent to the same recipient.
+ *
+ * @param[out] ct String containing the ciphertext
+ * @param[out] ss String containing the shared secret
+ * @param[in] epk Expanded public key
+ * @returns 0 if encapsulation is successful
+ */
+int crypto_kem_enc_expanded(unsigned char *ct, unsigned char *ss, const hqc_expanded_pk *epk) {
+    uint64_t scratch[KEM_ENC_SCRATCH_SIZE_64] SCRATCH_ALIGN;
+
+    return kem_enc(ct, ss, NULL, epk, scratch);
+}
+
+
+
+/**
+ * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme to an expanded public key working in a caller-provided buffer
+ *
+ * Same as crypto_kem_enc_expanded, with the vectors and the multiplication buffers placed in <b>scratch</b>
+ * instead of the stack.
+ *
+ * @param[out] ct String containing the ciphertext
+ * @param[out] ss String containing the shared secret
+ * @param[in] epk Expanded public key
+ * @param[in] scratch Buffer of CRYPTO_SCRATCHBYTES bytes aligned on 64 bytes, its content is overwritten
+ * @returns 0 if encapsulation is successful
+ */
+int crypto_kem_enc_expanded_ctx(unsigned char *ct, unsigned char *ss, const hqc_expanded_pk *epk, void *scratch) {
+    return kem_enc(ct, ss, NULL, epk, scratch);
+}
+
+
+
+/**
+ * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme, to a public key string or to an expanded public key
+ *
+ * @param[out] ct String containing the ciphertext
+ * @param[out] ss String containing the shared secret
+ * @param[in] pk String containing the public key, used if <b>epk</b> is NULL
+ * @param[in] epk Expanded public key, or NULL
+ * @param[in] scratch Scratch buffer of KEM_ENC_SCRATCH_SIZE_64 words
+ * @returns 0 if encapsulation is successful
+ */
+static int kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk, const hqc_expanded_pk *epk, uint64_t *scratch) {
     #ifdef VERBOSE
         printf("\n\n\n\n### ENCAPS ###");
     #endif
 
     uint8_t theta[SHAKE256_512_BYTES] = {0};
     uint64_t m[VEC_K_SIZE_64] = {0};
-    uint64_t u[VEC_N_SIZE_64] = {0};
-    uint64_t v[VEC_N1N2_SIZE_64] = {0};
     uint8_t d[SHAKE256_512_BYTES] = {0};
-    uint8_t mc[VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES + VEC_N1N2_SIZE_BYTES] = {0};
+    uint64_t *u = scratch;
+    uint64_t *v = u + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint8_t *mc = (uint8_t *) (v + SCRATCH_WORDS(VEC_N1N2_SIZE_64));
     shake256incctx shake256state;
 
+    scratch = v + SCRATCH_WORDS(VEC_N1N2_SIZE_64) + SCRATCH_WORDS(CEIL_DIVIDE(MC_BYTES, 8));
+
     // Computing m
     vect_set_random_from_prng(m);
 
@@ -68,7 +185,11 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     shake256_512_ds(&shake256state, theta, (uint8_t*) m, VEC_K_SIZE_BYTES, G_FCT_DOMAIN);
 
     // Encrypting m
-    hqc_pke_encrypt(u, v, m, theta, pk);
+    if (epk) {
+        hqc_pke_encrypt_expanded(u, v, m, theta, epk, scratch);
+    } else {
+        hqc_pke_encrypt(u, v, m, theta, pk, scratch);
+    }
 
     // Computing d
     shake256_512_ds(&shake256state, d, (uint8_t *) m, VEC_K_SIZE_BYTES, H_FCT_DOMAIN);
@@ -77,13 +198,15 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     memcpy(mc, m, VEC_K_SIZE_BYTES);
     memcpy(mc + VEC_K_SIZE_BYTES, u, VEC_N_SIZE_BYTES);
     memcpy(mc + VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES, v, VEC_N1N2_SIZE_BYTES);
-    shake256_512_ds(&shake256state, ss, mc, VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES + VEC_N1N2_SIZE_BYTES, K_FCT_DOMAIN);
+    shake256_512_ds(&shake256state, ss, mc, MC_BYTES, K_FCT_DOMAIN);
 
     // Computing ciphertext
     hqc_ciphertext_to_string(ct, u, v, d);
 
     #ifdef VERBOSE
-        printf("\n\npk: "); for(int i = 0 ; i < PUBLIC_KEY_BYTES ; ++i) printf("%02x", pk[i]);
+        if (pk) {
+            printf("\n\npk: "); for(int i = 0 ; i < PUBLIC_KEY_BYTES ; ++i) printf("%02x", pk[i]);
+        }
         printf("\n\nm: "); vect_print(m, VEC_K_SIZE_BYTES);
         printf("\n\ntheta: "); for(int i = 0 ; i < SHAKE256_512_BYTES ; ++i) printf("%02x", theta[i]);
         printf("\n\nd: "); for(int i = 0 ; i < SHAKE256_512_BYTES ; ++i) printf("%02x", d[i]);
@@ -105,37 +228,116 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
  * @returns 0 if decapsulation is successful, -1 otherwise
  */
 int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk) {
+    uint64_t scratch[KEM_DEC_SCRATCH_SIZE_64] SCRATCH_ALIGN;
+
+    return kem_dec(ss, ct, sk, NULL, scratch);
+}
+
+
+
+/**
+ * @brief Decapsulation of the HQC_KEM IND_CAA2 scheme working in a caller-provided buffer
+ *
+ * Same as crypto_kem_dec, with the vectors and the multiplication buffers placed in <b>scratch</b>
+ * instead of the stack.
+ *
+ * @param[out] ss String containing the shared secret
+ * @param[in] ct String containing the cipĥertext
+ * @param[in] sk String containing the secret key
+ * @param[in] scratch Buffer of CRYPTO_SCRATCHBYTES bytes aligned on 64 bytes, its content is overwritten
+ * @returns 0 if decapsulation is successful, -1 otherwise
+ */
+int crypto_kem_dec_ctx(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *scratch) {
+    return kem_dec(ss, ct, sk, NULL, scratch);
+}
+
+
+
+/**
+ * @brief Decapsulation of the HQC_KEM IND_CAA2 scheme with an expanded secret key
+ *
+ * Same as crypto_kem_dec, with the secret key expanded beforehand by hqc_sk_expand, so that only
+ * the work depending on the ciphertext is done here.
+ *
+ * @param[out] ss String containing the shared secret
+ * @param[in] ct String containing the ciphertext
+ * @param[in] esk Expanded secret key
+ * @returns 0 if decapsulation is successful, -1 otherwise
+ */
+int crypto_kem_dec_expanded(unsigned char *ss, const unsigned char *ct, const hqc_expanded_sk *esk) {
+    uint64_t scratch[KEM_DEC_SCRATCH_SIZE_64] SCRATCH_ALIGN;
+
+    return kem_dec(ss, ct, NULL, esk, scratch);
+}
+
+
+
+/**
+ * @brief Decapsulation of the HQC_KEM IND_CAA2 scheme with an expanded secret key working in a caller-provided buffer
+ *
+ * Same as crypto_kem_dec_expanded, with the vectors and the multiplication buffers placed in <b>scratch</b>
+ * instead of the stack.
+ *
+ * @param[out] ss String containing the shared secret
+ * @param[in] ct String containing the ciphertext
+ * @param[in] esk Expanded secret key
+ * @param[in] scratch Buffer of CRYPTO_SCRATCHBYTES bytes aligned on 64 bytes, its content is overwritten
+ * @returns 0 if decapsulation is successful, -1 otherwise
+ */
+int crypto_kem_dec_expanded_ctx(unsigned char *ss, const unsigned char *ct, const hqc_expanded_sk *esk, void *scratch) {
+    return kem_dec(ss, ct, NULL, esk, scratch);
+}
+
+
+
+/**
+ * @brief Decapsulation of the HQC_KEM IND_CAA2 scheme, with a secret key string or an expanded secret key
+ *
+ * @param[out] ss String containing the shared secret
+ * @param[in] ct String containing the ciphertext
+ * @param[in] sk String containing the secret key, used if <b>esk</b> is NULL
+ * @param[in] esk Expanded secret key, or NULL
+ * @param[in] scratch Scratch buffer of KEM_DEC_SCRATCH_SIZE_64 words
+ * @returns 0 if decapsulation is successful, -1 otherwise
+ */
+static int kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, const hqc_expanded_sk *esk, uint64_t *scratch) {
     #ifdef VERBOSE
         printf("\n\n\n\n### DECAPS ###");
     #endif
 
     uint8_t result;
-    uint64_t u[VEC_N_SIZE_64] = {0};
-    uint64_t v[VEC_N1N2_SIZE_64] = {0};
     uint8_t d[SHAKE256_512_BYTES] = {0};
-    uint8_t pk[PUBLIC_KEY_BYTES] = {0};
     uint64_t m[VEC_K_SIZE_64] = {0};
     uint8_t theta[SHAKE256_512_BYTES] = {0};
-    uint64_t u2[VEC_N_SIZE_64] = {0};
-    uint64_t v2[VEC_N1N2_SIZE_64] = {0};
     uint8_t d2[SHAKE256_512_BYTES] = {0};
-    uint8_t mc[VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES + VEC_N1N2_SIZE_BYTES] = {0};
+    uint64_t *u = scratch;
+    uint64_t *v = u + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint64_t *u2 = v + SCRATCH_WORDS(VEC_N1N2_SIZE_64);
+    uint64_t *v2 = u2 + SCRATCH_WORDS(VEC_N_SIZE_64);
+    uint8_t *mc = (uint8_t *) (v2 + SCRATCH_WORDS(VEC_N1N2_SIZE_64));
     shake256incctx shake256state;
 
+    scratch = v2 + SCRATCH_WORDS(VEC_N1N2_SIZE_64) + SCRATCH_WORDS(CEIL_DIVIDE(MC_BYTES, 8));
+
     // Retrieving u, v and d from ciphertext
     hqc_ciphertext_from_string(u, v , d, ct);
 
-    // Retrieving pk from sk
-    memcpy(pk, sk + SEED_BYTES, PUBLIC_KEY_BYTES);
-
     // Decryting
-    hqc_pke_decrypt(m, u, v, sk);
+    if (esk) {
+        hqc_pke_decrypt_expanded(m, u, v, esk, scratch);
+    } else {
+        hqc_pke_decrypt(m, u, v, sk, scratch);
+    }
 
     // Computing theta
     shake256_512_ds(&shake256state, theta, (uint8_t*) m, VEC_K_SIZE_BYTES, G_FCT_DOMAIN);
 
-    // Encrypting m'
-    hqc_pke_encrypt(u2, v2, m, theta, pk);
+    // Encrypting m', the public key being appended to the secret key
+    if (esk) {
+        hqc_pke_encrypt_expanded(u2, v2, m, theta, &esk->epk, scratch);
+    } else {
+        hqc_pke_encrypt(u2, v2, m, theta, sk + SEED_BYTES, scratch);
+    }
 
     // Computing d'
     shake256_512_ds(&shake256state, d2, (uint8_t *) m, VEC_K_SIZE_BYTES, H_FCT_DOMAIN);
@@ -144,7 +346,7 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     memcpy(mc, m, VEC_K_SIZE_BYTES);
     memcpy(mc + VEC_K_SIZE_BYTES, u, VEC_N_SIZE_BYTES);
     memcpy(mc + VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES, v, VEC_N1N2_SIZE_BYTES);
-    shake256_512_ds(&shake256state, ss, mc, VEC_K_SIZE_BYTES + VEC_N_SIZE_BYTES + VEC_N1N2_SIZE_BYTES, K_FCT_DOMAIN);
+    shake256_512_ds(&shake256state, ss, mc, MC_BYTES, K_FCT_DOMAIN);
 
     // Abort if c != c' or d != d'
     result = vect_compare((uint8_t *)u, (uint8_t *)u2, VEC_N_SIZE_BYTES);
@@ -158,8 +360,11 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     }
 
     #ifdef VERBOSE
+        const unsigned char *pk = esk ? esk->pk : sk + SEED_BYTES;
         printf("\n\npk: "); for(int i = 0 ; i < PUBLIC_KEY_BYTES ; ++i) printf("%02x", pk[i]);
-        printf("\n\nsk: "); for(int i = 0 ; i < SECRET_KEY_BYTES ; ++i) printf("%02x", sk[i]);
+        if (sk) {
+            printf("\n\nsk: "); for(int i = 0 ; i < SECRET_KEY_BYTES ; ++i) printf("%02x", sk[i]);
+        }
         printf("\n\nciphertext: "); for(int i = 0 ; i < CIPHERTEXT_BYTES ; ++i) printf("%02x", ct[i]);
         printf("\n\nm: "); vect_print(m, VEC_K_SIZE_BYTES);
         printf("\n\ntheta: "); for(int i = 0 ; i < SHAKE256_512_BYTES ; ++i) printf("%02x", theta[i]);
@@ -0,0 +1,93 @@
+/**
+ * @file hqc_kem.c
+ * @brief Dispatch of the HQC_KEM IND-CCA2 functions on the security level
+ */
+
+#include "hqc_kem.h"
+#include <stddef.h>
+
+extern const hqc_kem_params hqc128_kem_params;
+extern const hqc_kem_params hqc192_kem_params;
+extern const hqc_kem_params hqc256_kem_params;
+
+
+/**
+ * @brief Returns the sizes and functions of a security level
+ *
+ * @param[in] level Security level
+ * @returns the parameters of the level, or NULL if the level is not supported
+ */
+const hqc_kem_params *hqc_kem_get_params(hqc_level level) {
+    switch (level) {
+        case HQC_128:
+            return &hqc128_kem_params;
+        case HQC_192:
+            return &hqc192_kem_params;
+        case HQC_256:
+            return &hqc256_kem_params;
+        default:
+            return NULL;
+    }
+}
+
+
+
+/**
+ * @brief Keygen of the HQC_KEM IND_CAA2 scheme at a given security level
+ *
+ * @param[in] level Security level
+ * @param[out] pk String containing the public key
+ * @param[out] sk String containing the secret key
+ * @returns 0 if keygen is successful, -1 if the level is not supported
+ */
+int hqc_kem_keypair(hqc_level level, unsigned char *pk, unsigned char *sk) {
+    const hqc_kem_params *params = hqc_kem_get_params(level);
+
+    if (params == NULL) {
+        return -1;
+    }
+
+    return params->keypair(pk, sk);
+}
+
+
+
+/**
+ * @brief Encapsulation of the HQC_KEM IND_CAA2 scheme at a given security level
+ *
+ * @param[in] level Security level
+ * @param[out] ct String containing the ciphertext
+ * @param[out] ss String containing the shared secret
+ * @param[in] pk String containing the public key
+ * @returns 0 if encapsulation is successful, -1 if the level is not supported
+ */
+int hqc_kem_enc(hqc_level level, unsigned char *ct, unsigned char *ss, const unsigned char *pk) {
+    const hqc_kem_params *params = hqc_kem_get_params(level);
+
+    if (params == NULL) {
+        return -1;
+    }
+
+    return params->enc(ct, ss, pk);
+}
+
+
+
+/**
+ * @brief Decapsulation of the HQC_KEM IND_CAA2 scheme at a given security level
+ *
+ * @param[in] level Security level
+ * @param[out] ss String containing the shared secret
+ * @param[in] ct String containing the ciphertext
+ * @param[in] sk String containing the secret key
+ * @returns 0 if decapsulation is successful, -1 otherwise or if the level is not supported
+ */
+int hqc_kem_dec(hqc_level level, unsigned char *ss, const unsigned char *ct, const unsigned char *sk) {
+    const hqc_kem_params *params = hqc_kem_get_params(level);
+
+    if (params == NULL) {
+        return -1;
+    }
+
+    return params->dec(ss, ct, sk);
+}
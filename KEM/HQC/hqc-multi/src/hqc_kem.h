@@ -0,0 +1,55 @@
+#ifndef HQC_KEM_H
+#define HQC_KEM_H
+
+/**
+ * @file hqc_kem.h
+ * @brief HQC_KEM IND-CCA2 at the three security levels in a single library
+ *
+ * The functions of each level keep the NIST API of its api.h under the names hqc128_crypto_kem_*,
+ * hqc192_crypto_kem_* and hqc256_crypto_kem_*, reachable through hqc_kem_get_params, while
+ * hqc_kem_keypair, hqc_kem_enc and hqc_kem_dec dispatch on the level.
+ */
+
+#include <stddef.h>
+
+// Largest sizes over the three levels, to allocate buffers serving any of them
+#define HQC_KEM_MAX_PUBLICKEYBYTES          7245
+#define HQC_KEM_MAX_SECRETKEYBYTES          7285
+#define HQC_KEM_MAX_CIPHERTEXTBYTES         14469
+#define HQC_KEM_MAX_BYTES                   64
+#define HQC_KEM_MAX_SCRATCHBYTES            166144
+
+/**
+ * @brief Security levels of the library
+ */
+typedef enum hqc_level {
+    HQC_128 = 128,
+    HQC_192 = 192,
+    HQC_256 = 256
+} hqc_level;
+
+/**
+ * @brief Sizes and functions of one security level, i.e. the content of its api.h
+ */
+typedef struct hqc_kem_params {
+    const char *name;
+    size_t public_key_bytes;
+    size_t secret_key_bytes;
+    size_t ciphertext_bytes;
+    size_t shared_secret_bytes;
+    size_t scratch_bytes;
+    int (*keypair)(unsigned char *pk, unsigned char *sk);
+    int (*enc)(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+    int (*dec)(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+    int (*keypair_ctx)(unsigned char *pk, unsigned char *sk, void *scratch);
+    int (*enc_ctx)(unsigned char *ct, unsigned char *ss, const unsigned char *pk, void *scratch);
+    int (*dec_ctx)(unsigned char *ss, const unsigned char *ct, const unsigned char *sk, void *scratch);
+} hqc_kem_params;
+
+const hqc_kem_params *hqc_kem_get_params(hqc_level level);
+
+int hqc_kem_keypair(hqc_level level, unsigned char *pk, unsigned char *sk);
+int hqc_kem_enc(hqc_level level, unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int hqc_kem_dec(hqc_level level, unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+#endif
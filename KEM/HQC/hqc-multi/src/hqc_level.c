@@ -0,0 +1,32 @@
+/**
+ * @file hqc_level.c
+ * @brief Parameters of one security level of the multi-level library
+ *
+ * Compiled once per level against the sources of that level, so that its api.h provides the sizes
+ * and hqc_namespace.h gives its functions and kem_params the prefix of the level.
+ */
+
+#include "api.h"
+#include "hqc_kem.h"
+
+// Fails to compile if the maximal sizes of hqc_kem.h are too small for this level
+typedef char hqc_kem_max_bytes_check[(CRYPTO_PUBLICKEYBYTES <= HQC_KEM_MAX_PUBLICKEYBYTES
+                                      && CRYPTO_SECRETKEYBYTES <= HQC_KEM_MAX_SECRETKEYBYTES
+                                      && CRYPTO_CIPHERTEXTBYTES <= HQC_KEM_MAX_CIPHERTEXTBYTES
+                                      && CRYPTO_BYTES <= HQC_KEM_MAX_BYTES
+                                      && CRYPTO_SCRATCHBYTES <= HQC_KEM_MAX_SCRATCHBYTES) ? 1 : -1];
+
+const hqc_kem_params kem_params = {
+    CRYPTO_ALGNAME,
+    CRYPTO_PUBLICKEYBYTES,
+    CRYPTO_SECRETKEYBYTES,
+    CRYPTO_CIPHERTEXTBYTES,
+    CRYPTO_BYTES,
+    CRYPTO_SCRATCHBYTES,
+    crypto_kem_keypair,
+    crypto_kem_enc,
+    crypto_kem_dec,
+    crypto_kem_keypair_ctx,
+    crypto_kem_enc_ctx,
+    crypto_kem_dec_ctx
+};
@@ -0,0 +1,143 @@
+#ifndef HQC_NAMESPACE_H
+#define HQC_NAMESPACE_H
+
+/**
+ * @file hqc_namespace.h
+ * @brief Renames the global symbols of the HQC sources for the multi-level library
+ *
+ * This header is force-included (-include) in every source of the library. The sources of a
+ * security level are compiled with HQC_PREFIX set to hqc128_, hqc192_ or hqc256_. The code shared
+ * by the three levels (SHA3, SHAKE and GF(2^8) arithmetic) is compiled once with the prefix hqc_.
+ */
+
+#define HQC_CONCAT_(a, b) a##b
+#define HQC_CONCAT(a, b) HQC_CONCAT_(a, b)
+#define HQC_NAMESPACE(s) HQC_CONCAT(HQC_PREFIX, s)
+#define HQC_SHARED_NAMESPACE(s) HQC_CONCAT(hqc_, s)
+
+
+// code.c
+#define code_decode HQC_NAMESPACE(code_decode)
+#define code_encode HQC_NAMESPACE(code_encode)
+
+// fft.c
+#define fft HQC_NAMESPACE(fft)
+#define fft_retrieve_error_poly HQC_NAMESPACE(fft_retrieve_error_poly)
+
+// gf2x.c
+#define base_mul HQC_NAMESPACE(base_mul)
+#define karatsuba HQC_NAMESPACE(karatsuba)
+#define karatsuba_add1 HQC_NAMESPACE(karatsuba_add1)
+#define karatsuba_add2 HQC_NAMESPACE(karatsuba_add2)
+#define vect_mul HQC_NAMESPACE(vect_mul)
+#define vect_mul_fixed_weight HQC_NAMESPACE(vect_mul_fixed_weight)
+#define vect_mul_fixed_weight_prepared HQC_NAMESPACE(vect_mul_fixed_weight_prepared)
+#define vect_mul_prepare HQC_NAMESPACE(vect_mul_prepare)
+#define vect_mul_prepared_fixed_weight HQC_NAMESPACE(vect_mul_prepared_fixed_weight)
+#define vect_mul_sparse HQC_NAMESPACE(vect_mul_sparse)
+
+// hqc.c
+#define hqc_pk_expand HQC_NAMESPACE(hqc_pk_expand)
+#define hqc_pk_expand_ctx HQC_NAMESPACE(hqc_pk_expand_ctx)
+#define hqc_pke_decrypt HQC_NAMESPACE(hqc_pke_decrypt)
+#define hqc_pke_decrypt_expanded HQC_NAMESPACE(hqc_pke_decrypt_expanded)
+#define hqc_pke_encrypt HQC_NAMESPACE(hqc_pke_encrypt)
+#define hqc_pke_encrypt_expanded HQC_NAMESPACE(hqc_pke_encrypt_expanded)
+#define hqc_pke_keygen HQC_NAMESPACE(hqc_pke_keygen)
+#define hqc_sk_expand HQC_NAMESPACE(hqc_sk_expand)
+#define hqc_sk_expand_ctx HQC_NAMESPACE(hqc_sk_expand_ctx)
+
+// kem.c
+#define crypto_kem_dec HQC_NAMESPACE(crypto_kem_dec)
+#define crypto_kem_dec_ctx HQC_NAMESPACE(crypto_kem_dec_ctx)
+#define crypto_kem_dec_expanded HQC_NAMESPACE(crypto_kem_dec_expanded)
+#define crypto_kem_dec_expanded_ctx HQC_NAMESPACE(crypto_kem_dec_expanded_ctx)
+#define crypto_kem_enc HQC_NAMESPACE(crypto_kem_enc)
+#define crypto_kem_enc_ctx HQC_NAMESPACE(crypto_kem_enc_ctx)
+#define crypto_kem_enc_expanded HQC_NAMESPACE(crypto_kem_enc_expanded)
+#define crypto_kem_enc_expanded_ctx HQC_NAMESPACE(crypto_kem_enc_expanded_ctx)
+#define crypto_kem_keypair HQC_NAMESPACE(crypto_kem_keypair)
+#define crypto_kem_keypair_ctx HQC_NAMESPACE(crypto_kem_keypair_ctx)
+
+// parsing.c
+#define hqc_ciphertext_from_string HQC_NAMESPACE(hqc_ciphertext_from_string)
+#define hqc_ciphertext_to_string HQC_NAMESPACE(hqc_ciphertext_to_string)
+#define hqc_public_key_from_string HQC_NAMESPACE(hqc_public_key_from_string)
+#define hqc_public_key_to_string HQC_NAMESPACE(hqc_public_key_to_string)
+#define hqc_secret_key_from_string HQC_NAMESPACE(hqc_secret_key_from_string)
+#define hqc_secret_key_to_string HQC_NAMESPACE(hqc_secret_key_to_string)
+
+// reed_muller.c
+#define encode HQC_NAMESPACE(encode)
+#define expand_and_sum HQC_NAMESPACE(expand_and_sum)
+#define find_peaks HQC_NAMESPACE(find_peaks)
+#define hadamard HQC_NAMESPACE(hadamard)
+#define reed_muller_decode HQC_NAMESPACE(reed_muller_decode)
+#define reed_muller_encode HQC_NAMESPACE(reed_muller_encode)
+
+// reed_solomon.c
+#define compute_generator_poly HQC_NAMESPACE(compute_generator_poly)
+#define reed_solomon_decode HQC_NAMESPACE(reed_solomon_decode)
+#define reed_solomon_encode HQC_NAMESPACE(reed_solomon_encode)
+
+// vector.c
+#define vect_add HQC_NAMESPACE(vect_add)
+#define vect_compare HQC_NAMESPACE(vect_compare)
+#define vect_print HQC_NAMESPACE(vect_print)
+#define vect_print_sparse HQC_NAMESPACE(vect_print_sparse)
+#define vect_resize HQC_NAMESPACE(vect_resize)
+#define vect_set_random HQC_NAMESPACE(vect_set_random)
+#define vect_set_random_fixed_weight HQC_NAMESPACE(vect_set_random_fixed_weight)
+#define vect_set_random_fixed_weight_sparse HQC_NAMESPACE(vect_set_random_fixed_weight_sparse)
+#define vect_set_random_from_prng HQC_NAMESPACE(vect_set_random_from_prng)
+
+// hqc_level.c
+#define kem_params HQC_NAMESPACE(kem_params)
+
+
+// fips202.c (shared)
+#define sha3_256 HQC_SHARED_NAMESPACE(sha3_256)
+#define sha3_256_inc_absorb HQC_SHARED_NAMESPACE(sha3_256_inc_absorb)
+#define sha3_256_inc_finalize HQC_SHARED_NAMESPACE(sha3_256_inc_finalize)
+#define sha3_256_inc_init HQC_SHARED_NAMESPACE(sha3_256_inc_init)
+#define sha3_384 HQC_SHARED_NAMESPACE(sha3_384)
+#define sha3_384_inc_absorb HQC_SHARED_NAMESPACE(sha3_384_inc_absorb)
+#define sha3_384_inc_finalize HQC_SHARED_NAMESPACE(sha3_384_inc_finalize)
+#define sha3_384_inc_init HQC_SHARED_NAMESPACE(sha3_384_inc_init)
+#define sha3_512 HQC_SHARED_NAMESPACE(sha3_512)
+#define sha3_512_inc_absorb HQC_SHARED_NAMESPACE(sha3_512_inc_absorb)
+#define sha3_512_inc_finalize HQC_SHARED_NAMESPACE(sha3_512_inc_finalize)
+#define sha3_512_inc_init HQC_SHARED_NAMESPACE(sha3_512_inc_init)
+#define shake128 HQC_SHARED_NAMESPACE(shake128)
+#define shake128_absorb HQC_SHARED_NAMESPACE(shake128_absorb)
+#define shake128_inc_absorb HQC_SHARED_NAMESPACE(shake128_inc_absorb)
+#define shake128_inc_finalize HQC_SHARED_NAMESPACE(shake128_inc_finalize)
+#define shake128_inc_init HQC_SHARED_NAMESPACE(shake128_inc_init)
+#define shake128_inc_squeeze HQC_SHARED_NAMESPACE(shake128_inc_squeeze)
+#define shake128_squeezeblocks HQC_SHARED_NAMESPACE(shake128_squeezeblocks)
+#define shake256 HQC_SHARED_NAMESPACE(shake256)
+#define shake256_absorb HQC_SHARED_NAMESPACE(shake256_absorb)
+#define shake256_inc_absorb HQC_SHARED_NAMESPACE(shake256_inc_absorb)
+#define shake256_inc_finalize HQC_SHARED_NAMESPACE(shake256_inc_finalize)
+#define shake256_inc_init HQC_SHARED_NAMESPACE(shake256_inc_init)
+#define shake256_inc_squeeze HQC_SHARED_NAMESPACE(shake256_inc_squeeze)
+#define shake256_squeezeblocks HQC_SHARED_NAMESPACE(shake256_squeezeblocks)
+
+// gf.c (shared)
+#define gf_carryless_mul HQC_SHARED_NAMESPACE(gf_carryless_mul)
+#define gf_generate HQC_SHARED_NAMESPACE(gf_generate)
+#define gf_inverse HQC_SHARED_NAMESPACE(gf_inverse)
+#define gf_mod HQC_SHARED_NAMESPACE(gf_mod)
+#define gf_mul HQC_SHARED_NAMESPACE(gf_mul)
+#define gf_square HQC_SHARED_NAMESPACE(gf_square)
+#define trailing_zero_bits_count HQC_SHARED_NAMESPACE(trailing_zero_bits_count)
+
+// shake_ds.c and shake_prng.c (shared)
+#define shake256_512_ds HQC_SHARED_NAMESPACE(shake256_512_ds)
+#define seedexpander HQC_SHARED_NAMESPACE(seedexpander)
+#define seedexpander_init HQC_SHARED_NAMESPACE(seedexpander_init)
+#define shake_prng HQC_SHARED_NAMESPACE(shake_prng)
+#define shake_prng_init HQC_SHARED_NAMESPACE(shake_prng_init)
+#define shake_prng_state HQC_SHARED_NAMESPACE(shake_prng_state)
+
+#endif
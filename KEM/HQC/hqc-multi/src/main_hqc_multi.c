@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <string.h>
+#include "hqc_kem.h"
+
+int main() {
+
+	const hqc_level levels[] = { HQC_128, HQC_192, HQC_256 };
+
+	unsigned char pk[HQC_KEM_MAX_PUBLICKEYBYTES];
+	unsigned char sk[HQC_KEM_MAX_SECRETKEYBYTES];
+	unsigned char ct[HQC_KEM_MAX_CIPHERTEXTBYTES];
+	unsigned char key1[HQC_KEM_MAX_BYTES];
+	unsigned char key2[HQC_KEM_MAX_BYTES];
+	int failures = 0;
+
+	for(size_t l = 0 ; l < sizeof(levels) / sizeof(levels[0]) ; ++l) {
+		const hqc_kem_params *params = hqc_kem_get_params(levels[l]);
+
+		printf("\n");
+		printf("*********************\n");
+		printf("****** %s ******\n", params->name);
+		printf("*********************\n");
+
+		printf("\n");
+		printf("pk: %zu bytes   ", params->public_key_bytes);
+		printf("sk: %zu bytes   ", params->secret_key_bytes);
+		printf("ct: %zu bytes", params->ciphertext_bytes);
+		printf("\n");
+
+		hqc_kem_keypair(levels[l], pk, sk);
+		hqc_kem_enc(levels[l], ct, key1, pk);
+		hqc_kem_dec(levels[l], key2, ct, sk);
+
+		printf("\nsecret1: ");
+		for(size_t i = 0 ; i < params->shared_secret_bytes ; ++i) printf("%x", key1[i]);
+
+		printf("\nsecret2: ");
+		for(size_t i = 0 ; i < params->shared_secret_bytes ; ++i) printf("%x", key2[i]);
+		printf("\n");
+
+		if(memcmp(key1, key2, params->shared_secret_bytes) != 0) {
+			printf("secrets differ\n");
+			failures++;
+		}
+	}
+	printf("\n");
+
+	return failures != 0;
+}
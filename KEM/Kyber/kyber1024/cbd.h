@@ -11,4 +11,12 @@ void cbd_eta1(poly *r, const uint8_t buf[KYBER_ETA1*KYBER_N/4]);
 #define cbd_eta2 KYBER_NAMESPACE(_cbd_eta2)
 void cbd_eta2(poly *r, const uint8_t buf[KYBER_ETA2*KYBER_N/4]);
 
+#ifdef KYBER_USE_AVX2
+#define cbd_eta1_avx2 KYBER_NAMESPACE(_cbd_eta1_avx2)
+void cbd_eta1_avx2(poly *r, const uint8_t buf[KYBER_ETA1*KYBER_N/4]);
+
+#define cbd_eta2_avx2 KYBER_NAMESPACE(_cbd_eta2_avx2)
+void cbd_eta2_avx2(poly *r, const uint8_t buf[KYBER_ETA2*KYBER_N/4]);
+#endif
+
 #endif
@@ -22,4 +22,15 @@ void basemul(int16_t r[2],
              const int16_t b[2],
              int16_t zeta);
 
+#ifdef KYBER_USE_AVX2
+#define ntt_avx2 KYBER_NAMESPACE(_ntt_avx2)
+void ntt_avx2(int16_t poly[256]);
+
+#define invntt_avx2 KYBER_NAMESPACE(_invntt_avx2)
+void invntt_avx2(int16_t poly[256]);
+
+#define basemul_avx2 KYBER_NAMESPACE(_basemul_avx2)
+void basemul_avx2(int16_t r[256], const int16_t a[256], const int16_t b[256]);
+#endif
+
 #endif
@@ -0,0 +1,79 @@
+#ifndef REDUCE_AVX2_H
+#define REDUCE_AVX2_H
+
+#include <immintrin.h>
+#include "params.h"
+#include "reduce.h"
+
+/*
+ * 16-lane counterparts of the scalar routines in reduce.c. Every lane
+ * computes exactly the same 16-bit value as the scalar code, so the
+ * vectorized paths stay bit-identical to the reference implementation.
+ */
+
+/*************************************************
+* Name:        fqmul_avx2
+*
+* Description: Lane-wise multiplication followed by Montgomery reduction;
+*              equivalent to montgomery_reduce((int32_t)a*b) in every lane
+*
+* Arguments:   - __m256i a: first factors
+*              - __m256i b: second factors
+*
+* Returns 16-bit integers congruent to a*b*R^{-1} mod q
+**************************************************/
+static inline __m256i fqmul_avx2(__m256i a, __m256i b)
+{
+  const __m256i q = _mm256_set1_epi16(KYBER_Q);
+  const __m256i qinv = _mm256_set1_epi16((int16_t)QINV);
+  __m256i lo, hi;
+
+  hi = _mm256_mulhi_epi16(a, b);
+  lo = _mm256_mullo_epi16(a, b);
+  lo = _mm256_mullo_epi16(lo, qinv);
+  lo = _mm256_mulhi_epi16(lo, q);
+  return _mm256_sub_epi16(hi, lo);
+}
+
+/*************************************************
+* Name:        barrett_reduce_avx2
+*
+* Description: Lane-wise Barrett reduction; equivalent to barrett_reduce
+*
+* Arguments:   - __m256i a: input integers to be reduced
+*
+* Returns integers in {0,...,q} congruent to a modulo q.
+**************************************************/
+static inline __m256i barrett_reduce_avx2(__m256i a)
+{
+  const __m256i q = _mm256_set1_epi16(KYBER_Q);
+  const __m256i v = _mm256_set1_epi16(((1U << 26) + KYBER_Q/2)/KYBER_Q);
+  __m256i t;
+
+  t = _mm256_mulhi_epi16(a, v);
+  t = _mm256_srai_epi16(t, 10);
+  t = _mm256_mullo_epi16(t, q);
+  return _mm256_sub_epi16(a, t);
+}
+
+/*************************************************
+* Name:        csubq_avx2
+*
+* Description: Lane-wise conditional subtraction of q; equivalent to csubq
+*
+* Arguments:   - __m256i a: input integers
+*
+* Returns a - q in lanes where a >= q, else a
+**************************************************/
+static inline __m256i csubq_avx2(__m256i a)
+{
+  const __m256i q = _mm256_set1_epi16(KYBER_Q);
+  __m256i m;
+
+  a = _mm256_sub_epi16(a, q);
+  m = _mm256_srai_epi16(a, 15);
+  m = _mm256_and_si256(m, q);
+  return _mm256_add_epi16(a, m);
+}
+
+#endif
@@ -0,0 +1,346 @@
+#include <immintrin.h>
+#include <stdint.h>
+#include "params.h"
+#include "rejsample_avx2.h"
+
+#ifdef KYBER_USE_AVX2
+
+/*
+ * rej_idx[m] lists the byte offsets (within a 128-bit register) of the
+ * 16-bit lanes whose bit is set in the 8-bit mask m, in increasing order;
+ * unused slots are -1. Generated by
+
+  for(m = 0; m < 256; ++m)
+    for(i = 0, j = 0; i < 8; ++i)
+      if(m >> i & 1)
+        rej_idx[m][j++] = 2*i;
+
+ */
+static const int8_t rej_idx[256][8] __attribute__((aligned(8))) = {
+  {-1, -1, -1, -1, -1, -1, -1, -1},
+  { 0, -1, -1, -1, -1, -1, -1, -1},
+  { 2, -1, -1, -1, -1, -1, -1, -1},
+  { 0,  2, -1, -1, -1, -1, -1, -1},
+  { 4, -1, -1, -1, -1, -1, -1, -1},
+  { 0,  4, -1, -1, -1, -1, -1, -1},
+  { 2,  4, -1, -1, -1, -1, -1, -1},
+  { 0,  2,  4, -1, -1, -1, -1, -1},
+  { 6, -1, -1, -1, -1, -1, -1, -1},
+  { 0,  6, -1, -1, -1, -1, -1, -1},
+  { 2,  6, -1, -1, -1, -1, -1, -1},
+  { 0,  2,  6, -1, -1, -1, -1, -1},
+  { 4,  6, -1, -1, -1, -1, -1, -1},
+  { 0,  4,  6, -1, -1, -1, -1, -1},
+  { 2,  4,  6, -1, -1, -1, -1, -1},
+  { 0,  2,  4,  6, -1, -1, -1, -1},
+  { 8, -1, -1, -1, -1, -1, -1, -1},
+  { 0,  8, -1, -1, -1, -1, -1, -1},
+  { 2,  8, -1, -1, -1, -1, -1, -1},
+  { 0,  2,  8, -1, -1, -1, -1, -1},
+  { 4,  8, -1, -1, -1, -1, -1, -1},
+  { 0,  4,  8, -1, -1, -1, -1, -1},
+  { 2,  4,  8, -1, -1, -1, -1, -1},
+  { 0,  2,  4,  8, -1, -1, -1, -1},
+  { 6,  8, -1, -1, -1, -1, -1, -1},
+  { 0,  6,  8, -1, -1, -1, -1, -1},
+  { 2,  6,  8, -1, -1, -1, -1, -1},
+  { 0,  2,  6,  8, -1, -1, -1, -1},
+  { 4,  6,  8, -1, -1, -1, -1, -1},
+  { 0,  4,  6,  8, -1, -1, -1, -1},
+  { 2,  4,  6,  8, -1, -1, -1, -1},
+  { 0,  2,  4,  6,  8, -1, -1, -1},
+  {10, -1, -1, -1, -1, -1, -1, -1},
+  { 0, 10, -1, -1, -1, -1, -1, -1},
+  { 2, 10, -1, -1, -1, -1, -1, -1},
+  { 0,  2, 10, -1, -1, -1, -1, -1},
+  { 4, 10, -1, -1, -1, -1, -1, -1},
+  { 0,  4, 10, -1, -1, -1, -1, -1},
+  { 2,  4, 10, -1, -1, -1, -1, -1},
+  { 0,  2,  4, 10, -1, -1, -1, -1},
+  { 6, 10, -1, -1, -1, -1, -1, -1},
+  { 0,  6, 10, -1, -1, -1, -1, -1},
+  { 2,  6, 10, -1, -1, -1, -1, -1},
+  { 0,  2,  6, 10, -1, -1, -1, -1},
+  { 4,  6, 10, -1, -1, -1, -1, -1},
+  { 0,  4,  6, 10, -1, -1, -1, -1},
+  { 2,  4,  6, 10, -1, -1, -1, -1},
+  { 0,  2,  4,  6, 10, -1, -1, -1},
+  { 8, 10, -1, -1, -1, -1, -1, -1},
+  { 0,  8, 10, -1, -1, -1, -1, -1},
+  { 2,  8, 10, -1, -1, -1, -1, -1},
+  { 0,  2,  8, 10, -1, -1, -1, -1},
+  { 4,  8, 10, -1, -1, -1, -1, -1},
+  { 0,  4,  8, 10, -1, -1, -1, -1},
+  { 2,  4,  8, 10, -1, -1, -1, -1},
+  { 0,  2,  4,  8, 10, -1, -1, -1},
+  { 6,  8, 10, -1, -1, -1, -1, -1},
+  { 0,  6,  8, 10, -1, -1, -1, -1},
+  { 2,  6,  8, 10, -1, -1, -1, -1},
+  { 0,  2,  6,  8, 10, -1, -1, -1},
+  { 4,  6,  8, 10, -1, -1, -1, -1},
+  { 0,  4,  6,  8, 10, -1, -1, -1},
+  { 2,  4,  6,  8, 10, -1, -1, -1},
+  { 0,  2,  4,  6,  8, 10, -1, -1},
+  {12, -1, -1, -1, -1, -1, -1, -1},
+  { 0, 12, -1, -1, -1, -1, -1, -1},
+  { 2, 12, -1, -1, -1, -1, -1, -1},
+  { 0,  2, 12, -1, -1, -1, -1, -1},
+  { 4, 12, -1, -1, -1, -1, -1, -1},
+  { 0,  4, 12, -1, -1, -1, -1, -1},
+  { 2,  4, 12, -1, -1, -1, -1, -1},
+  { 0,  2,  4, 12, -1, -1, -1, -1},
+  { 6, 12, -1, -1, -1, -1, -1, -1},
+  { 0,  6, 12, -1, -1, -1, -1, -1},
+  { 2,  6, 12, -1, -1, -1, -1, -1},
+  { 0,  2,  6, 12, -1, -1, -1, -1},
+  { 4,  6, 12, -1, -1, -1, -1, -1},
+  { 0,  4,  6, 12, -1, -1, -1, -1},
+  { 2,  4,  6, 12, -1, -1, -1, -1},
+  { 0,  2,  4,  6, 12, -1, -1, -1},
+  { 8, 12, -1, -1, -1, -1, -1, -1},
+  { 0,  8, 12, -1, -1, -1, -1, -1},
+  { 2,  8, 12, -1, -1, -1, -1, -1},
+  { 0,  2,  8, 12, -1, -1, -1, -1},
+  { 4,  8, 12, -1, -1, -1, -1, -1},
+  { 0,  4,  8, 12, -1, -1, -1, -1},
+  { 2,  4,  8, 12, -1, -1, -1, -1},
+  { 0,  2,  4,  8, 12, -1, -1, -1},
+  { 6,  8, 12, -1, -1, -1, -1, -1},
+  { 0,  6,  8, 12, -1, -1, -1, -1},
+  { 2,  6,  8, 12, -1, -1, -1, -1},
+  { 0,  2,  6,  8, 12, -1, -1, -1},
+  { 4,  6,  8, 12, -1, -1, -1, -1},
+  { 0,  4,  6,  8, 12, -1, -1, -1},
+  { 2,  4,  6,  8, 12, -1, -1, -1},
+  { 0,  2,  4,  6,  8, 12, -1, -1},
+  {10, 12, -1, -1, -1, -1, -1, -1},
+  { 0, 10, 12, -1, -1, -1, -1, -1},
+  { 2, 10, 12, -1, -1, -1, -1, -1},
+  { 0,  2, 10, 12, -1, -1, -1, -1},
+  { 4, 10, 12, -1, -1, -1, -1, -1},
+  { 0,  4, 10, 12, -1, -1, -1, -1},
+  { 2,  4, 10, 12, -1, -1, -1, -1},
+  { 0,  2,  4, 10, 12, -1, -1, -1},
+  { 6, 10, 12, -1, -1, -1, -1, -1},
+  { 0,  6, 10, 12, -1, -1, -1, -1},
+  { 2,  6, 10, 12, -1, -1, -1, -1},
+  { 0,  2,  6, 10, 12, -1, -1, -1},
+  { 4,  6, 10, 12, -1, -1, -1, -1},
+  { 0,  4,  6, 10, 12, -1, -1, -1},
+  { 2,  4,  6, 10, 12, -1, -1, -1},
+  { 0,  2,  4,  6, 10, 12, -1, -1},
+  { 8, 10, 12, -1, -1, -1, -1, -1},
+  { 0,  8, 10, 12, -1, -1, -1, -1},
+  { 2,  8, 10, 12, -1, -1, -1, -1},
+  { 0,  2,  8, 10, 12, -1, -1, -1},
+  { 4,  8, 10, 12, -1, -1, -1, -1},
+  { 0,  4,  8, 10, 12, -1, -1, -1},
+  { 2,  4,  8, 10, 12, -1, -1, -1},
+  { 0,  2,  4,  8, 10, 12, -1, -1},
+  { 6,  8, 10, 12, -1, -1, -1, -1},
+  { 0,  6,  8, 10, 12, -1, -1, -1},
+  { 2,  6,  8, 10, 12, -1, -1, -1},
+  { 0,  2,  6,  8, 10, 12, -1, -1},
+  { 4,  6,  8, 10, 12, -1, -1, -1},
+  { 0,  4,  6,  8, 10, 12, -1, -1},
+  { 2,  4,  6,  8, 10, 12, -1, -1},
+  { 0,  2,  4,  6,  8, 10, 12, -1},
+  {14, -1, -1, -1, -1, -1, -1, -1},
+  { 0, 14, -1, -1, -1, -1, -1, -1},
+  { 2, 14, -1, -1, -1, -1, -1, -1},
+  { 0,  2, 14, -1, -1, -1, -1, -1},
+  { 4, 14, -1, -1, -1, -1, -1, -1},
+  { 0,  4, 14, -1, -1, -1, -1, -1},
+  { 2,  4, 14, -1, -1, -1, -1, -1},
+  { 0,  2,  4, 14, -1, -1, -1, -1},
+  { 6, 14, -1, -1, -1, -1, -1, -1},
+  { 0,  6, 14, -1, -1, -1, -1, -1},
+  { 2,  6, 14, -1, -1, -1, -1, -1},
+  { 0,  2,  6, 14, -1, -1, -1, -1},
+  { 4,  6, 14, -1, -1, -1, -1, -1},
+  { 0,  4,  6, 14, -1, -1, -1, -1},
+  { 2,  4,  6, 14, -1, -1, -1, -1},
+  { 0,  2,  4,  6, 14, -1, -1, -1},
+  { 8, 14, -1, -1, -1, -1, -1, -1},
+  { 0,  8, 14, -1, -1, -1, -1, -1},
+  { 2,  8, 14, -1, -1, -1, -1, -1},
+  { 0,  2,  8, 14, -1, -1, -1, -1},
+  { 4,  8, 14, -1, -1, -1, -1, -1},
+  { 0,  4,  8, 14, -1, -1, -1, -1},
+  { 2,  4,  8, 14, -1, -1, -1, -1},
+  { 0,  2,  4,  8, 14, -1, -1, -1},
+  { 6,  8, 14, -1, -1, -1, -1, -1},
+  { 0,  6,  8, 14, -1, -1, -1, -1},
+  { 2,  6,  8, 14, -1, -1, -1, -1},
+  { 0,  2,  6,  8, 14, -1, -1, -1},
+  { 4,  6,  8, 14, -1, -1, -1, -1},
+  { 0,  4,  6,  8, 14, -1, -1, -1},
+  { 2,  4,  6,  8, 14, -1, -1, -1},
+  { 0,  2,  4,  6,  8, 14, -1, -1},
+  {10, 14, -1, -1, -1, -1, -1, -1},
+  { 0, 10, 14, -1, -1, -1, -1, -1},
+  { 2, 10, 14, -1, -1, -1, -1, -1},
+  { 0,  2, 10, 14, -1, -1, -1, -1},
+  { 4, 10, 14, -1, -1, -1, -1, -1},
+  { 0,  4, 10, 14, -1, -1, -1, -1},
+  { 2,  4, 10, 14, -1, -1, -1, -1},
+  { 0,  2,  4, 10, 14, -1, -1, -1},
+  { 6, 10, 14, -1, -1, -1, -1, -1},
+  { 0,  6, 10, 14, -1, -1, -1, -1},
+  { 2,  6, 10, 14, -1, -1, -1, -1},
+  { 0,  2,  6, 10, 14, -1, -1, -1},
+  { 4,  6, 10, 14, -1, -1, -1, -1},
+  { 0,  4,  6, 10, 14, -1, -1, -1},
+  { 2,  4,  6, 10, 14, -1, -1, -1},
+  { 0,  2,  4,  6, 10, 14, -1, -1},
+  { 8, 10, 14, -1, -1, -1, -1, -1},
+  { 0,  8, 10, 14, -1, -1, -1, -1},
+  { 2,  8, 10, 14, -1, -1, -1, -1},
+  { 0,  2,  8, 10, 14, -1, -1, -1},
+  { 4,  8, 10, 14, -1, -1, -1, -1},
+  { 0,  4,  8, 10, 14, -1, -1, -1},
+  { 2,  4,  8, 10, 14, -1, -1, -1},
+  { 0,  2,  4,  8, 10, 14, -1, -1},
+  { 6,  8, 10, 14, -1, -1, -1, -1},
+  { 0,  6,  8, 10, 14, -1, -1, -1},
+  { 2,  6,  8, 10, 14, -1, -1, -1},
+  { 0,  2,  6,  8, 10, 14, -1, -1},
+  { 4,  6,  8, 10, 14, -1, -1, -1},
+  { 0,  4,  6,  8, 10, 14, -1, -1},
+  { 2,  4,  6,  8, 10, 14, -1, -1},
+  { 0,  2,  4,  6,  8, 10, 14, -1},
+  {12, 14, -1, -1, -1, -1, -1, -1},
+  { 0, 12, 14, -1, -1, -1, -1, -1},
+  { 2, 12, 14, -1, -1, -1, -1, -1},
+  { 0,  2, 12, 14, -1, -1, -1, -1},
+  { 4, 12, 14, -1, -1, -1, -1, -1},
+  { 0,  4, 12, 14, -1, -1, -1, -1},
+  { 2,  4, 12, 14, -1, -1, -1, -1},
+  { 0,  2,  4, 12, 14, -1, -1, -1},
+  { 6, 12, 14, -1, -1, -1, -1, -1},
+  { 0,  6, 12, 14, -1, -1, -1, -1},
+  { 2,  6, 12, 14, -1, -1, -1, -1},
+  { 0,  2,  6, 12, 14, -1, -1, -1},
+  { 4,  6, 12, 14, -1, -1, -1, -1},
+  { 0,  4,  6, 12, 14, -1, -1, -1},
+  { 2,  4,  6, 12, 14, -1, -1, -1},
+  { 0,  2,  4,  6, 12, 14, -1, -1},
+  { 8, 12, 14, -1, -1, -1, -1, -1},
+  { 0,  8, 12, 14, -1, -1, -1, -1},
+  { 2,  8, 12, 14, -1, -1, -1, -1},
+  { 0,  2,  8, 12, 14, -1, -1, -1},
+  { 4,  8, 12, 14, -1, -1, -1, -1},
+  { 0,  4,  8, 12, 14, -1, -1, -1},
+  { 2,  4,  8, 12, 14, -1, -1, -1},
+  { 0,  2,  4,  8, 12, 14, -1, -1},
+  { 6,  8, 12, 14, -1, -1, -1, -1},
+  { 0,  6,  8, 12, 14, -1, -1, -1},
+  { 2,  6,  8, 12, 14, -1, -1, -1},
+  { 0,  2,  6,  8, 12, 14, -1, -1},
+  { 4,  6,  8, 12, 14, -1, -1, -1},
+  { 0,  4,  6,  8, 12, 14, -1, -1},
+  { 2,  4,  6,  8, 12, 14, -1, -1},
+  { 0,  2,  4,  6,  8, 12, 14, -1},
+  {10, 12, 14, -1, -1, -1, -1, -1},
+  { 0, 10, 12, 14, -1, -1, -1, -1},
+  { 2, 10, 12, 14, -1, -1, -1, -1},
+  { 0,  2, 10, 12, 14, -1, -1, -1},
+  { 4, 10, 12, 14, -1, -1, -1, -1},
+  { 0,  4, 10, 12, 14, -1, -1, -1},
+  { 2,  4, 10, 12, 14, -1, -1, -1},
+  { 0,  2,  4, 10, 12, 14, -1, -1},
+  { 6, 10, 12, 14, -1, -1, -1, -1},
+  { 0,  6, 10, 12, 14, -1, -1, -1},
+  { 2,  6, 10, 12, 14, -1, -1, -1},
+  { 0,  2,  6, 10, 12, 14, -1, -1},
+  { 4,  6, 10, 12, 14, -1, -1, -1},
+  { 0,  4,  6, 10, 12, 14, -1, -1},
+  { 2,  4,  6, 10, 12, 14, -1, -1},
+  { 0,  2,  4,  6, 10, 12, 14, -1},
+  { 8, 10, 12, 14, -1, -1, -1, -1},
+  { 0,  8, 10, 12, 14, -1, -1, -1},
+  { 2,  8, 10, 12, 14, -1, -1, -1},
+  { 0,  2,  8, 10, 12, 14, -1, -1},
+  { 4,  8, 10, 12, 14, -1, -1, -1},
+  { 0,  4,  8, 10, 12, 14, -1, -1},
+  { 2,  4,  8, 10, 12, 14, -1, -1},
+  { 0,  2,  4,  8, 10, 12, 14, -1},
+  { 6,  8, 10, 12, 14, -1, -1, -1},
+  { 0,  6,  8, 10, 12, 14, -1, -1},
+  { 2,  6,  8, 10, 12, 14, -1, -1},
+  { 0,  2,  6,  8, 10, 12, 14, -1},
+  { 4,  6,  8, 10, 12, 14, -1, -1},
+  { 0,  4,  6,  8, 10, 12, 14, -1},
+  { 2,  4,  6,  8, 10, 12, 14, -1},
+  { 0,  2,  4,  6,  8, 10, 12, 14}
+};
+
+/*************************************************
+* Name:        rej_uniform_avx2
+*
+* Description: Vectorized front end of rej_uniform. Processes 16 candidate
+*              12-bit values (24 bytes of buf) per iteration and compacts
+*              the accepted ones with a shuffle from rej_idx, keeping their
+*              order. Stops while at least 16 outputs are still missing and
+*              32 input bytes are left, so the caller finishes with the
+*              scalar loop and the overall output is unchanged.
+*
+* Arguments:   - int16_t *r:          pointer to output buffer
+*              - unsigned int len:    requested number of 16-bit integers
+*              - const uint8_t *buf:  pointer to input buffer
+*              - unsigned int buflen: length of input buffer in bytes
+*              - unsigned int *pos:   pointer to output number of consumed
+*                                     bytes of buf
+*
+* Returns number of sampled 16-bit integers (at most len)
+**************************************************/
+unsigned int rej_uniform_avx2(int16_t *r,
+                              unsigned int len,
+                              const uint8_t *buf,
+                              unsigned int buflen,
+                              unsigned int *pos)
+{
+  unsigned int ctr, p, good;
+  __m256i f, g;
+  __m128i v, pi;
+  const __m256i bound = _mm256_set1_epi16(KYBER_Q);
+  const __m256i mask = _mm256_set1_epi16(0xFFF);
+  const __m256i shuf = _mm256_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5,
+                                        6, 7, 7, 8, 9, 10, 10, 11,
+                                        4, 5, 5, 6, 7, 8, 8, 9,
+                                        10, 11, 11, 12, 13, 14, 14, 15);
+  const __m128i ones = _mm_set1_epi8(1);
+
+  ctr = p = 0;
+  while(ctr + 16 <= len && p + 32 <= buflen) {
+    /* bytes 0..15 to the low and 8..23 to the high 128-bit lane */
+    f = _mm256_loadu_si256((__m256i *)&buf[p]);
+    f = _mm256_permute4x64_epi64(f, 0x94);
+    f = _mm256_shuffle_epi8(f, shuf);
+    g = _mm256_srli_epi16(f, 4);
+    f = _mm256_blend_epi16(f, g, 0xAA);
+    f = _mm256_and_si256(f, mask);
+    p += 24;
+
+    g = _mm256_cmpgt_epi16(bound, f);
+    g = _mm256_packs_epi16(g, g);
+    good = _mm256_movemask_epi8(g);
+
+    v = _mm256_castsi256_si128(f);
+    pi = _mm_loadl_epi64((__m128i *)&rej_idx[good & 0xFF]);
+    pi = _mm_unpacklo_epi8(pi, _mm_add_epi8(pi, ones));
+    _mm_storeu_si128((__m128i *)&r[ctr], _mm_shuffle_epi8(v, pi));
+    ctr += __builtin_popcount(good & 0xFF);
+
+    v = _mm256_extracti128_si256(f, 1);
+    pi = _mm_loadl_epi64((__m128i *)&rej_idx[(good >> 16) & 0xFF]);
+    pi = _mm_unpacklo_epi8(pi, _mm_add_epi8(pi, ones));
+    _mm_storeu_si128((__m128i *)&r[ctr], _mm_shuffle_epi8(v, pi));
+    ctr += __builtin_popcount((good >> 16) & 0xFF);
+  }
+
+  *pos = p;
+  return ctr;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "api.h"
+#include "kem.h"
+#include "kempool.h"
+#include "rng.h"
+
+#define NTHREADS 4
+#define NKEYS 256   /* keypairs taken by every consumer thread */
+
+/*
+ * Concurrent consumers drain the keypair pool while its worker refills
+ * it. Every keypair handed out must be valid (the secret key opens a
+ * ciphertext to the public key), no public key may be handed out twice,
+ * and the counters must account for every keypair the worker produced.
+ */
+static unsigned char pks[NTHREADS*NKEYS][CRYPTO_PUBLICKEYBYTES];
+static int invalid[NTHREADS];
+
+static void *consumer(void *arg)
+{
+  unsigned int i, t = (unsigned int)(uintptr_t)arg;
+  unsigned char sk[CRYPTO_SECRETKEYBYTES];
+  unsigned char ct[CRYPTO_CIPHERTEXTBYTES];
+  unsigned char key1[CRYPTO_BYTES], key2[CRYPTO_BYTES];
+  unsigned char *pk;
+
+  for(i=0;i<NKEYS;i++) {
+    pk = pks[t*NKEYS + i];
+    crypto_kem_keypair_pooled(pk, sk);
+    crypto_kem_enc(ct, key1, pk);
+    crypto_kem_dec(key2, ct, sk);
+    invalid[t] += memcmp(key1, key2, CRYPTO_BYTES) != 0;
+  }
+
+  return NULL;
+}
+
+static int cmp_pk(const void *a, const void *b)
+{
+  return memcmp(a, b, CRYPTO_PUBLICKEYBYTES);
+}
+
+int main(void)
+{
+  unsigned int i;
+  unsigned char seed[48];
+  pthread_t threads[NTHREADS];
+  crypto_kem_pool_stats stats;
+  int err = 0, dups = 0, bad = 0;
+
+  for(i=0;i<48;i++)
+    seed[i] = i;
+  randombytes_init(seed, NULL, 256);
+
+  if(crypto_kem_pool_start() != 0) {
+    printf("%s pool: cannot start worker\n", CRYPTO_ALGNAME);
+    return 1;
+  }
+
+  /* Let the worker fill the ring so that the consumers start with hits */
+  do {
+    sched_yield();
+    crypto_kem_pool_get_stats(&stats);
+  } while(stats.refills < KYBER_POOL_SIZE);
+
+  for(i=0;i<NTHREADS;i++)
+    if(pthread_create(&threads[i], NULL, consumer, (void *)(uintptr_t)i) != 0) {
+      printf("%s pool: cannot start consumer\n", CRYPTO_ALGNAME);
+      return 1;
+    }
+  for(i=0;i<NTHREADS;i++)
+    pthread_join(threads[i], NULL);
+
+  crypto_kem_pool_stop();
+  crypto_kem_pool_get_stats(&stats);
+
+  for(i=0;i<NTHREADS;i++)
+    bad += invalid[i];
+
+  qsort(pks, NTHREADS*NKEYS, CRYPTO_PUBLICKEYBYTES, cmp_pk);
+  for(i=1;i<NTHREADS*NKEYS;i++)
+    dups += memcmp(pks[i-1], pks[i], CRYPTO_PUBLICKEYBYTES) == 0;
+
+  /* Every call is a hit or a miss; every refill was handed out or was
+   * still in the ring when the pool stopped */
+  err |= bad != 0 || dups != 0;
+  err |= stats.hits + stats.misses != NTHREADS*NKEYS;
+  err |= stats.hits < KYBER_POOL_SIZE;
+  err |= stats.refills < stats.hits || stats.refills - stats.hits > KYBER_POOL_SIZE;
+
+  printf("%s pool: hits %llu, misses %llu, refills %llu, invalid %d, duplicates %d: %s\n",
+         CRYPTO_ALGNAME, (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+         (unsigned long long)stats.refills, bad, dups, err ? "FAILED" : "OK");
+  return err;
+}
@@ -0,0 +1,610 @@
+/* Four-way parallel Keccak on AVX2, following the structure of the
+ * scalar implementation in fips202.c: lane k of every 256-bit register
+ * belongs to the k-th of four independent Keccak states. */
+
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "fips202.h"
+#include "fips202x4.h"
+
+#ifdef __AVX2__
+
+#define NROUNDS 24
+#define XOR256(a, b) _mm256_xor_si256(a, b)
+#define ANDNOT256(a, b) _mm256_andnot_si256(a, b)
+#define ROL256(a, offset) _mm256_or_si256(_mm256_slli_epi64(a, offset), \
+                                          _mm256_srli_epi64(a, 64-(offset)))
+
+/* Keccak round constants */
+static const uint64_t KeccakF_RoundConstants[NROUNDS] = {
+  (uint64_t)0x0000000000000001ULL,
+  (uint64_t)0x0000000000008082ULL,
+  (uint64_t)0x800000000000808aULL,
+  (uint64_t)0x8000000080008000ULL,
+  (uint64_t)0x000000000000808bULL,
+  (uint64_t)0x0000000080000001ULL,
+  (uint64_t)0x8000000080008081ULL,
+  (uint64_t)0x8000000000008009ULL,
+  (uint64_t)0x000000000000008aULL,
+  (uint64_t)0x0000000000000088ULL,
+  (uint64_t)0x0000000080008009ULL,
+  (uint64_t)0x000000008000000aULL,
+  (uint64_t)0x000000008000808bULL,
+  (uint64_t)0x800000000000008bULL,
+  (uint64_t)0x8000000000008089ULL,
+  (uint64_t)0x8000000000008003ULL,
+  (uint64_t)0x8000000000008002ULL,
+  (uint64_t)0x8000000000000080ULL,
+  (uint64_t)0x000000000000800aULL,
+  (uint64_t)0x800000008000000aULL,
+  (uint64_t)0x8000000080008081ULL,
+  (uint64_t)0x8000000000008080ULL,
+  (uint64_t)0x0000000080000001ULL,
+  (uint64_t)0x8000000080008008ULL
+};
+
+/*************************************************
+* Name:        KeccakF1600_StatePermute4x
+*
+* Description: Four parallel instances of the Keccak F1600 Permutation
+*
+* Arguments:   - __m256i *state: pointer to input/output Keccak states
+**************************************************/
+static void KeccakF1600_StatePermute4x(__m256i state[25])
+{
+        int round;
+
+        __m256i Aba, Abe, Abi, Abo, Abu;
+        __m256i Aga, Age, Agi, Ago, Agu;
+        __m256i Aka, Ake, Aki, Ako, Aku;
+        __m256i Ama, Ame, Ami, Amo, Amu;
+        __m256i Asa, Ase, Asi, Aso, Asu;
+        __m256i BCa, BCe, BCi, BCo, BCu;
+        __m256i Da, De, Di, Do, Du;
+        __m256i Eba, Ebe, Ebi, Ebo, Ebu;
+        __m256i Ega, Ege, Egi, Ego, Egu;
+        __m256i Eka, Eke, Eki, Eko, Eku;
+        __m256i Ema, Eme, Emi, Emo, Emu;
+        __m256i Esa, Ese, Esi, Eso, Esu;
+
+        //copyFromState(A, state)
+        Aba = state[ 0];
+        Abe = state[ 1];
+        Abi = state[ 2];
+        Abo = state[ 3];
+        Abu = state[ 4];
+        Aga = state[ 5];
+        Age = state[ 6];
+        Agi = state[ 7];
+        Ago = state[ 8];
+        Agu = state[ 9];
+        Aka = state[10];
+        Ake = state[11];
+        Aki = state[12];
+        Ako = state[13];
+        Aku = state[14];
+        Ama = state[15];
+        Ame = state[16];
+        Ami = state[17];
+        Amo = state[18];
+        Amu = state[19];
+        Asa = state[20];
+        Ase = state[21];
+        Asi = state[22];
+        Aso = state[23];
+        Asu = state[24];
+
+        for( round = 0; round < NROUNDS; round += 2 )
+        {
+            //    prepareTheta
+            BCa = XOR256(XOR256(XOR256(XOR256(Aba, Aga), Aka), Ama), Asa);
+            BCe = XOR256(XOR256(XOR256(XOR256(Abe, Age), Ake), Ame), Ase);
+            BCi = XOR256(XOR256(XOR256(XOR256(Abi, Agi), Aki), Ami), Asi);
+            BCo = XOR256(XOR256(XOR256(XOR256(Abo, Ago), Ako), Amo), Aso);
+            BCu = XOR256(XOR256(XOR256(XOR256(Abu, Agu), Aku), Amu), Asu);
+
+            //thetaRhoPiChiIotaPrepareTheta(round  , A, E)
+            Da = XOR256(BCu, ROL256(BCe, 1));
+            De = XOR256(BCa, ROL256(BCi, 1));
+            Di = XOR256(BCe, ROL256(BCo, 1));
+            Do = XOR256(BCi, ROL256(BCu, 1));
+            Du = XOR256(BCo, ROL256(BCa, 1));
+
+            Aba = XOR256(Aba, Da);
+            BCa = Aba;
+            Age = XOR256(Age, De);
+            BCe = ROL256(Age, 44);
+            Aki = XOR256(Aki, Di);
+            BCi = ROL256(Aki, 43);
+            Amo = XOR256(Amo, Do);
+            BCo = ROL256(Amo, 21);
+            Asu = XOR256(Asu, Du);
+            BCu = ROL256(Asu, 14);
+            Eba = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Eba = XOR256(Eba, _mm256_set1_epi64x(KeccakF_RoundConstants[round]));
+            Ebe = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Ebi = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Ebo = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Ebu = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Abo = XOR256(Abo, Do);
+            BCa = ROL256(Abo, 28);
+            Agu = XOR256(Agu, Du);
+            BCe = ROL256(Agu, 20);
+            Aka = XOR256(Aka, Da);
+            BCi = ROL256(Aka, 3);
+            Ame = XOR256(Ame, De);
+            BCo = ROL256(Ame, 45);
+            Asi = XOR256(Asi, Di);
+            BCu = ROL256(Asi, 61);
+            Ega = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Ege = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Egi = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Ego = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Egu = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Abe = XOR256(Abe, De);
+            BCa = ROL256(Abe, 1);
+            Agi = XOR256(Agi, Di);
+            BCe = ROL256(Agi, 6);
+            Ako = XOR256(Ako, Do);
+            BCi = ROL256(Ako, 25);
+            Amu = XOR256(Amu, Du);
+            BCo = ROL256(Amu, 8);
+            Asa = XOR256(Asa, Da);
+            BCu = ROL256(Asa, 18);
+            Eka = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Eke = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Eki = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Eko = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Eku = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Abu = XOR256(Abu, Du);
+            BCa = ROL256(Abu, 27);
+            Aga = XOR256(Aga, Da);
+            BCe = ROL256(Aga, 36);
+            Ake = XOR256(Ake, De);
+            BCi = ROL256(Ake, 10);
+            Ami = XOR256(Ami, Di);
+            BCo = ROL256(Ami, 15);
+            Aso = XOR256(Aso, Do);
+            BCu = ROL256(Aso, 56);
+            Ema = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Eme = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Emi = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Emo = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Emu = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Abi = XOR256(Abi, Di);
+            BCa = ROL256(Abi, 62);
+            Ago = XOR256(Ago, Do);
+            BCe = ROL256(Ago, 55);
+            Aku = XOR256(Aku, Du);
+            BCi = ROL256(Aku, 39);
+            Ama = XOR256(Ama, Da);
+            BCo = ROL256(Ama, 41);
+            Ase = XOR256(Ase, De);
+            BCu = ROL256(Ase, 2);
+            Esa = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Ese = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Esi = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Eso = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Esu = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            //    prepareTheta
+            BCa = XOR256(XOR256(XOR256(XOR256(Eba, Ega), Eka), Ema), Esa);
+            BCe = XOR256(XOR256(XOR256(XOR256(Ebe, Ege), Eke), Eme), Ese);
+            BCi = XOR256(XOR256(XOR256(XOR256(Ebi, Egi), Eki), Emi), Esi);
+            BCo = XOR256(XOR256(XOR256(XOR256(Ebo, Ego), Eko), Emo), Eso);
+            BCu = XOR256(XOR256(XOR256(XOR256(Ebu, Egu), Eku), Emu), Esu);
+
+            //thetaRhoPiChiIotaPrepareTheta(round+1, E, A)
+            Da = XOR256(BCu, ROL256(BCe, 1));
+            De = XOR256(BCa, ROL256(BCi, 1));
+            Di = XOR256(BCe, ROL256(BCo, 1));
+            Do = XOR256(BCi, ROL256(BCu, 1));
+            Du = XOR256(BCo, ROL256(BCa, 1));
+
+            Eba = XOR256(Eba, Da);
+            BCa = Eba;
+            Ege = XOR256(Ege, De);
+            BCe = ROL256(Ege, 44);
+            Eki = XOR256(Eki, Di);
+            BCi = ROL256(Eki, 43);
+            Emo = XOR256(Emo, Do);
+            BCo = ROL256(Emo, 21);
+            Esu = XOR256(Esu, Du);
+            BCu = ROL256(Esu, 14);
+            Aba = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Aba = XOR256(Aba, _mm256_set1_epi64x(KeccakF_RoundConstants[round+1]));
+            Abe = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Abi = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Abo = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Abu = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Ebo = XOR256(Ebo, Do);
+            BCa = ROL256(Ebo, 28);
+            Egu = XOR256(Egu, Du);
+            BCe = ROL256(Egu, 20);
+            Eka = XOR256(Eka, Da);
+            BCi = ROL256(Eka, 3);
+            Eme = XOR256(Eme, De);
+            BCo = ROL256(Eme, 45);
+            Esi = XOR256(Esi, Di);
+            BCu = ROL256(Esi, 61);
+            Aga = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Age = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Agi = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Ago = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Agu = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Ebe = XOR256(Ebe, De);
+            BCa = ROL256(Ebe, 1);
+            Egi = XOR256(Egi, Di);
+            BCe = ROL256(Egi, 6);
+            Eko = XOR256(Eko, Do);
+            BCi = ROL256(Eko, 25);
+            Emu = XOR256(Emu, Du);
+            BCo = ROL256(Emu, 8);
+            Esa = XOR256(Esa, Da);
+            BCu = ROL256(Esa, 18);
+            Aka = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Ake = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Aki = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Ako = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Aku = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Ebu = XOR256(Ebu, Du);
+            BCa = ROL256(Ebu, 27);
+            Ega = XOR256(Ega, Da);
+            BCe = ROL256(Ega, 36);
+            Eke = XOR256(Eke, De);
+            BCi = ROL256(Eke, 10);
+            Emi = XOR256(Emi, Di);
+            BCo = ROL256(Emi, 15);
+            Eso = XOR256(Eso, Do);
+            BCu = ROL256(Eso, 56);
+            Ama = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Ame = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Ami = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Amo = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Amu = XOR256(BCu, ANDNOT256(BCa, BCe));
+
+            Ebi = XOR256(Ebi, Di);
+            BCa = ROL256(Ebi, 62);
+            Ego = XOR256(Ego, Do);
+            BCe = ROL256(Ego, 55);
+            Eku = XOR256(Eku, Du);
+            BCi = ROL256(Eku, 39);
+            Ema = XOR256(Ema, Da);
+            BCo = ROL256(Ema, 41);
+            Ese = XOR256(Ese, De);
+            BCu = ROL256(Ese, 2);
+            Asa = XOR256(BCa, ANDNOT256(BCe, BCi));
+            Ase = XOR256(BCe, ANDNOT256(BCi, BCo));
+            Asi = XOR256(BCi, ANDNOT256(BCo, BCu));
+            Aso = XOR256(BCo, ANDNOT256(BCu, BCa));
+            Asu = XOR256(BCu, ANDNOT256(BCa, BCe));
+        }
+
+        //copyToState(state, A)
+        state[ 0] = Aba;
+        state[ 1] = Abe;
+        state[ 2] = Abi;
+        state[ 3] = Abo;
+        state[ 4] = Abu;
+        state[ 5] = Aga;
+        state[ 6] = Age;
+        state[ 7] = Agi;
+        state[ 8] = Ago;
+        state[ 9] = Agu;
+        state[10] = Aka;
+        state[11] = Ake;
+        state[12] = Aki;
+        state[13] = Ako;
+        state[14] = Aku;
+        state[15] = Ama;
+        state[16] = Ame;
+        state[17] = Ami;
+        state[18] = Amo;
+        state[19] = Amu;
+        state[20] = Asa;
+        state[21] = Ase;
+        state[22] = Asi;
+        state[23] = Aso;
+        state[24] = Asu;
+}
+
+/*************************************************
+* Name:        keccakx4_absorb
+*
+* Description: Absorb step of Keccak on four inputs of equal length;
+*              non-incremental, starts by zeroeing the state.
+*
+* Arguments:   - __m256i *s: pointer to (uninitialized) output Keccak states
+*              - unsigned int r: rate in bytes (e.g., 168 for SHAKE128)
+*              - const uint8_t *in0, ..., *in3: pointers to inputs
+*              - size_t inlen: length of each input in bytes
+*              - uint8_t p: domain-separation byte for different
+*                           Keccak-derived functions
+**************************************************/
+static void keccakx4_absorb(__m256i s[25],
+                            unsigned int r,
+                            const uint8_t *in0,
+                            const uint8_t *in1,
+                            const uint8_t *in2,
+                            const uint8_t *in3,
+                            size_t inlen,
+                            uint8_t p)
+{
+  size_t i, pos = 0;
+  __m256i t, idx;
+  uint8_t buf[4][200] = {{0}};
+
+  for(i = 0; i < 25; ++i)
+    s[i] = _mm256_setzero_si256();
+
+  idx = _mm256_set_epi64x((long long)in3, (long long)in2,
+                          (long long)in1, (long long)in0);
+  while(inlen >= r) {
+    for(i = 0; i < r/8; ++i) {
+      t = _mm256_i64gather_epi64((long long *)pos, idx, 1);
+      s[i] = _mm256_xor_si256(s[i], t);
+      pos += 8;
+    }
+
+    KeccakF1600_StatePermute4x(s);
+    inlen -= r;
+  }
+
+  for(i = 0; i < inlen; ++i) {
+    buf[0][i] = in0[pos+i];
+    buf[1][i] = in1[pos+i];
+    buf[2][i] = in2[pos+i];
+    buf[3][i] = in3[pos+i];
+  }
+  for(i = 0; i < 4; ++i) {
+    buf[i][inlen] = p;
+    buf[i][r-1] |= 128;
+  }
+
+  idx = _mm256_set_epi64x((long long)buf[3], (long long)buf[2],
+                          (long long)buf[1], (long long)buf[0]);
+  for(i = 0; i < r/8; ++i) {
+    t = _mm256_i64gather_epi64((long long *)(8*i), idx, 1);
+    s[i] = _mm256_xor_si256(s[i], t);
+  }
+}
+
+/*************************************************
+* Name:        keccakx4_squeezeblocks
+*
+* Description: Squeeze step of Keccak on four states. Squeezes full blocks
+*              of r bytes each into every output. Modifies the states.
+*              Can be called multiple times to keep squeezing.
+*
+* Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+*              - size_t nblocks: number of blocks to be squeezed
+*              - unsigned int r: rate in bytes (e.g., 168 for SHAKE128)
+*              - __m256i *s: pointer to input/output Keccak states
+**************************************************/
+static void keccakx4_squeezeblocks(uint8_t *out0,
+                                   uint8_t *out1,
+                                   uint8_t *out2,
+                                   uint8_t *out3,
+                                   size_t nblocks,
+                                   unsigned int r,
+                                   __m256i s[25])
+{
+  unsigned int i;
+  __m128d t;
+
+  while(nblocks > 0) {
+    KeccakF1600_StatePermute4x(s);
+    for(i = 0; i < r/8; ++i) {
+      t = _mm_castsi128_pd(_mm256_castsi256_si128(s[i]));
+      _mm_storel_pd((double *)&out0[8*i], t);
+      _mm_storeh_pd((double *)&out1[8*i], t);
+      t = _mm_castsi128_pd(_mm256_extracti128_si256(s[i], 1));
+      _mm_storel_pd((double *)&out2[8*i], t);
+      _mm_storeh_pd((double *)&out3[8*i], t);
+    }
+
+    out0 += r;
+    out1 += r;
+    out2 += r;
+    out3 += r;
+    --nblocks;
+  }
+}
+
+/*************************************************
+* Name:        shake128x4_absorb
+*
+* Description: Absorb step of four parallel SHAKE128 XOFs;
+*              non-incremental, starts by zeroeing the states.
+*
+* Arguments:   - keccakx4_state *state: pointer to (uninitialized) output
+*                                       Keccak states
+*              - const uint8_t *in0, ..., *in3: pointers to inputs
+*              - size_t inlen: length of each input in bytes
+**************************************************/
+void shake128x4_absorb(keccakx4_state *state,
+                       const uint8_t *in0,
+                       const uint8_t *in1,
+                       const uint8_t *in2,
+                       const uint8_t *in3,
+                       size_t inlen)
+{
+  keccakx4_absorb(state->s, SHAKE128_RATE, in0, in1, in2, in3, inlen, 0x1F);
+}
+
+/*************************************************
+* Name:        shake128x4_squeezeblocks
+*
+* Description: Squeeze step of four parallel SHAKE128 XOFs. Squeezes full
+*              blocks of SHAKE128_RATE bytes into each output.
+*
+* Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+*              - size_t nblocks: number of blocks to be squeezed
+*              - keccakx4_state *state: pointer to input/output Keccak states
+**************************************************/
+void shake128x4_squeezeblocks(uint8_t *out0,
+                              uint8_t *out1,
+                              uint8_t *out2,
+                              uint8_t *out3,
+                              size_t nblocks,
+                              keccakx4_state *state)
+{
+  keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, SHAKE128_RATE,
+                         state->s);
+}
+
+/*************************************************
+* Name:        shake256x4_absorb
+*
+* Description: Absorb step of four parallel SHAKE256 XOFs;
+*              non-incremental, starts by zeroeing the states.
+*
+* Arguments:   - keccakx4_state *state: pointer to (uninitialized) output
+*                                       Keccak states
+*              - const uint8_t *in0, ..., *in3: pointers to inputs
+*              - size_t inlen: length of each input in bytes
+**************************************************/
+void shake256x4_absorb(keccakx4_state *state,
+                       const uint8_t *in0,
+                       const uint8_t *in1,
+                       const uint8_t *in2,
+                       const uint8_t *in3,
+                       size_t inlen)
+{
+  keccakx4_absorb(state->s, SHAKE256_RATE, in0, in1, in2, in3, inlen, 0x1F);
+}
+
+/*************************************************
+* Name:        shake256x4_squeezeblocks
+*
+* Description: Squeeze step of four parallel SHAKE256 XOFs. Squeezes full
+*              blocks of SHAKE256_RATE bytes into each output.
+*
+* Arguments:   - uint8_t *out0, ..., *out3: pointers to output blocks
+*              - size_t nblocks: number of blocks to be squeezed
+*              - keccakx4_state *state: pointer to input/output Keccak states
+**************************************************/
+void shake256x4_squeezeblocks(uint8_t *out0,
+                              uint8_t *out1,
+                              uint8_t *out2,
+                              uint8_t *out3,
+                              size_t nblocks,
+                              keccakx4_state *state)
+{
+  keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, SHAKE256_RATE,
+                         state->s);
+}
+
+/*************************************************
+* Name:        shake256x4
+*
+* Description: Four parallel SHAKE256 XOFs with non-incremental API
+*
+* Arguments:   - uint8_t *out0, ..., *out3: pointers to outputs
+*              - size_t outlen: requested output length in bytes
+*              - const uint8_t *in0, ..., *in3: pointers to inputs
+*              - size_t inlen: length of each input in bytes
+**************************************************/
+void shake256x4(uint8_t *out0,
+                uint8_t *out1,
+                uint8_t *out2,
+                uint8_t *out3,
+                size_t outlen,
+                const uint8_t *in0,
+                const uint8_t *in1,
+                const uint8_t *in2,
+                const uint8_t *in3,
+                size_t inlen)
+{
+  unsigned int i;
+  size_t nblocks = outlen/SHAKE256_RATE;
+  uint8_t t[4][SHAKE256_RATE];
+  keccakx4_state state;
+
+  shake256x4_absorb(&state, in0, in1, in2, in3, inlen);
+  shake256x4_squeezeblocks(out0, out1, out2, out3, nblocks, &state);
+
+  out0 += nblocks*SHAKE256_RATE;
+  out1 += nblocks*SHAKE256_RATE;
+  out2 += nblocks*SHAKE256_RATE;
+  out3 += nblocks*SHAKE256_RATE;
+  outlen -= nblocks*SHAKE256_RATE;
+
+  if(outlen) {
+    shake256x4_squeezeblocks(t[0], t[1], t[2], t[3], 1, &state);
+    for(i=0;i<outlen;i++) {
+      out0[i] = t[0][i];
+      out1[i] = t[1][i];
+      out2[i] = t[2][i];
+      out3[i] = t[3][i];
+    }
+  }
+}
+
+/* Permutes the state and writes the first outlen bytes of every lane */
+static void keccakx4_finalize(uint8_t *out0,
+                              uint8_t *out1,
+                              uint8_t *out2,
+                              uint8_t *out3,
+                              size_t outlen,
+                              __m256i s[25])
+{
+  unsigned int i;
+  __m128d t;
+
+  KeccakF1600_StatePermute4x(s);
+  for(i = 0; i < outlen/8; ++i) {
+    t = _mm_castsi128_pd(_mm256_castsi256_si128(s[i]));
+    _mm_storel_pd((double *)&out0[8*i], t);
+    _mm_storeh_pd((double *)&out1[8*i], t);
+    t = _mm_castsi128_pd(_mm256_extracti128_si256(s[i], 1));
+    _mm_storel_pd((double *)&out2[8*i], t);
+    _mm_storeh_pd((double *)&out3[8*i], t);
+  }
+}
+
+/* Four independent SHA3-256 hashes of equal-length inputs; outputs may
+ * alias inputs */
+void sha3_256x4(uint8_t *out0,
+                uint8_t *out1,
+                uint8_t *out2,
+                uint8_t *out3,
+                const uint8_t *in0,
+                const uint8_t *in1,
+                const uint8_t *in2,
+                const uint8_t *in3,
+                size_t inlen)
+{
+  __m256i s[25];
+
+  keccakx4_absorb(s, SHA3_256_RATE, in0, in1, in2, in3, inlen, 0x06);
+  keccakx4_finalize(out0, out1, out2, out3, 32, s);
+}
+
+/* Four independent SHA3-512 hashes of equal-length inputs; outputs may
+ * alias inputs */
+void sha3_512x4(uint8_t *out0,
+                uint8_t *out1,
+                uint8_t *out2,
+                uint8_t *out3,
+                const uint8_t *in0,
+                const uint8_t *in1,
+                const uint8_t *in2,
+                const uint8_t *in3,
+                size_t inlen)
+{
+  __m256i s[25];
+
+  keccakx4_absorb(s, SHA3_512_RATE, in0, in1, in2, in3, inlen, 0x06);
+  keccakx4_finalize(out0, out1, out2, out3, 64, s);
+}
+
+#endif
@@ -11,12 +11,42 @@ void gen_matrix(polyvec *a, const uint8_t seed[KYBER_SYMBYTES], int transposed);
 void indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
                     uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
 
+/* Public key with everything indcpa_enc derives from it precomputed */
+typedef struct {
+  polyvec pkpv;           /* t in NTT domain */
+  polyvec at[KYBER_K];    /* transposed matrix A^T */
+} indcpa_expanded_pk;
+
+#define indcpa_pk_expand KYBER_NAMESPACE(_indcpa_pk_expand)
+void indcpa_pk_expand(indcpa_expanded_pk *epk,
+                      const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES]);
+
+#define indcpa_enc_expanded KYBER_NAMESPACE(_indcpa_enc_expanded)
+void indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const indcpa_expanded_pk *epk,
+                         const uint8_t coins[KYBER_SYMBYTES]);
+
 #define indcpa_enc KYBER_NAMESPACE(_indcpa_enc)
 void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
                 const uint8_t m[KYBER_INDCPA_MSGBYTES],
                 const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
                 const uint8_t coins[KYBER_SYMBYTES]);
 
+/* Secret key unpacked once for repeated decryption */
+typedef struct {
+  polyvec skpv;           /* s in NTT domain */
+} indcpa_expanded_sk;
+
+#define indcpa_sk_expand KYBER_NAMESPACE(_indcpa_sk_expand)
+void indcpa_sk_expand(indcpa_expanded_sk *esk,
+                      const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES]);
+
+#define indcpa_dec_expanded KYBER_NAMESPACE(_indcpa_dec_expanded)
+void indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const indcpa_expanded_sk *esk);
+
 #define indcpa_dec KYBER_NAMESPACE(_indcpa_dec)
 void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
                 const uint8_t c[KYBER_INDCPA_BYTES],
@@ -6,6 +6,9 @@
 #include "symmetric.h"
 #include "verify.h"
 #include "indcpa.h"
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+#include "fips202x4.h"
+#endif
 
 /*************************************************
 * Name:        crypto_kem_keypair
@@ -51,6 +54,56 @@ int crypto_kem_enc(unsigned char *ct,
                    unsigned char *ss,
                    const unsigned char *pk)
 {
+  crypto_kem_expanded_pk epk;
+
+  crypto_kem_pk_expand(&epk, pk);
+  return crypto_kem_enc_expanded(ct, ss, &epk);
+}
+
+/*************************************************
+* Name:        crypto_kem_pk_expand
+*
+* Description: Prepares a public key for repeated encapsulation:
+*              unpacks it, expands the transposed matrix and hashes it
+*              once, so that crypto_kem_enc_expanded only has to do the
+*              per-message work
+*
+* Arguments:   - crypto_kem_expanded_pk *epk: pointer to output expanded public key
+*              - const unsigned char *pk: pointer to input public key
+*                (an already allocated array of CRYPTO_PUBLICKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_pk_expand(crypto_kem_expanded_pk *epk,
+                         const unsigned char *pk)
+{
+  indcpa_pk_expand(&epk->indcpa, pk);
+  hash_h(epk->hpk, pk, KYBER_PUBLICKEYBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_enc_expanded
+*
+* Description: Generates cipher text and shared
+*              secret for given expanded public key;
+*              output is identical to crypto_kem_enc
+*              on the original public key
+*
+* Arguments:   - unsigned char *ct: pointer to output cipher text
+*                (an already allocated array of CRYPTO_CIPHERTEXTBYTES bytes)
+*              - unsigned char *ss: pointer to output shared secret
+*                (an already allocated array of CRYPTO_BYTES bytes)
+*              - const crypto_kem_expanded_pk *epk: pointer to input
+*                public key expanded by crypto_kem_pk_expand
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_enc_expanded(unsigned char *ct,
+                            unsigned char *ss,
+                            const crypto_kem_expanded_pk *epk)
+{
+  unsigned int i;
   uint8_t buf[2*KYBER_SYMBYTES];
   /* Will contain key, coins */
   uint8_t kr[2*KYBER_SYMBYTES];
@@ -60,11 +113,12 @@ int crypto_kem_enc(unsigned char *ct,
   hash_h(buf, buf, KYBER_SYMBYTES);
 
   /* Multitarget countermeasure for coins + contributory KEM */
-  hash_h(buf+KYBER_SYMBYTES, pk, KYBER_PUBLICKEYBYTES);
+  for(i=0;i<KYBER_SYMBYTES;i++)
+    buf[KYBER_SYMBYTES+i] = epk->hpk[i];
   hash_g(kr, buf, 2*KYBER_SYMBYTES);
 
   /* coins are in kr+KYBER_SYMBYTES */
-  indcpa_enc(ct, buf, pk, kr+KYBER_SYMBYTES);
+  indcpa_enc_expanded(ct, buf, &epk->indcpa, kr+KYBER_SYMBYTES);
 
   /* overwrite coins in kr with H(c) */
   hash_h(kr+KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
@@ -73,6 +127,93 @@ int crypto_kem_enc(unsigned char *ct,
   return 0;
 }
 
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+/*************************************************
+* Name:        crypto_kem_enc_x4
+*
+* Description: Four independent encapsulations with every hash computed
+*              by 4-way parallel Keccak; identical to four consecutive
+*              calls of crypto_kem_enc
+*
+* Arguments:   - unsigned char *const ct[4]: pointers to output cipher texts
+*              - unsigned char *const ss[4]: pointers to output shared secrets
+*              - const unsigned char *const pk[4]: pointers to input public keys
+**************************************************/
+static void crypto_kem_enc_x4(unsigned char *const ct[4],
+                              unsigned char *const ss[4],
+                              const unsigned char *const pk[4])
+{
+  unsigned int j;
+  uint8_t buf[4][2*KYBER_SYMBYTES];
+  /* Will contain key, coins */
+  uint8_t kr[4][2*KYBER_SYMBYTES];
+  indcpa_expanded_pk epk;
+
+  for(j=0;j<4;j++)
+    randombytes(buf[j], KYBER_SYMBYTES);
+  /* Don't release system RNG output */
+  sha3_256x4(buf[0], buf[1], buf[2], buf[3],
+             buf[0], buf[1], buf[2], buf[3], KYBER_SYMBYTES);
+
+  /* Multitarget countermeasure for coins + contributory KEM */
+  sha3_256x4(buf[0]+KYBER_SYMBYTES, buf[1]+KYBER_SYMBYTES,
+             buf[2]+KYBER_SYMBYTES, buf[3]+KYBER_SYMBYTES,
+             pk[0], pk[1], pk[2], pk[3], KYBER_PUBLICKEYBYTES);
+  sha3_512x4(kr[0], kr[1], kr[2], kr[3],
+             buf[0], buf[1], buf[2], buf[3], 2*KYBER_SYMBYTES);
+
+  /* coins are in kr+KYBER_SYMBYTES; one public key at a time, so that
+   * its matrix is still in cache when it is multiplied */
+  for(j=0;j<4;j++) {
+    indcpa_pk_expand(&epk, pk[j]);
+    indcpa_enc_expanded(ct[j], buf[j], &epk, kr[j]+KYBER_SYMBYTES);
+  }
+
+  /* overwrite coins in kr with H(c) */
+  sha3_256x4(kr[0]+KYBER_SYMBYTES, kr[1]+KYBER_SYMBYTES,
+             kr[2]+KYBER_SYMBYTES, kr[3]+KYBER_SYMBYTES,
+             ct[0], ct[1], ct[2], ct[3], KYBER_CIPHERTEXTBYTES);
+  /* hash concatenation of pre-k and H(c) to k */
+  shake256x4(ss[0], ss[1], ss[2], ss[3], KYBER_SSBYTES,
+             kr[0], kr[1], kr[2], kr[3], 2*KYBER_SYMBYTES);
+}
+#endif
+
+/*************************************************
+* Name:        crypto_kem_enc_batch
+*
+* Description: Generates cipher texts and shared secrets for n
+*              independent public keys, interleaving the symmetric
+*              work of four encapsulations at a time where supported.
+*              Output is identical to n consecutive calls of
+*              crypto_kem_enc(ct[i], ss[i], pk[i]).
+*
+* Arguments:   - unsigned char *const ct[]: array of n pointers to output
+*                cipher texts (each of CRYPTO_CIPHERTEXTBYTES bytes)
+*              - unsigned char *const ss[]: array of n pointers to output
+*                shared secrets (each of CRYPTO_BYTES bytes)
+*              - const unsigned char *const pk[]: array of n pointers to
+*                input public keys (each of CRYPTO_PUBLICKEYBYTES bytes)
+*              - size_t n: number of encapsulations
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_enc_batch(unsigned char *const ct[],
+                         unsigned char *const ss[],
+                         const unsigned char *const pk[],
+                         size_t n)
+{
+  size_t i = 0;
+
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+  for(;i+4<=n;i+=4)
+    crypto_kem_enc_x4(ct+i, ss+i, pk+i);
+#endif
+  for(;i<n;i++)
+    crypto_kem_enc(ct[i], ss[i], pk[i]);
+  return 0;
+}
+
 /*************************************************
 * Name:        crypto_kem_dec
 *
@@ -93,6 +234,62 @@ int crypto_kem_enc(unsigned char *ct,
 int crypto_kem_dec(unsigned char *ss,
                    const unsigned char *ct,
                    const unsigned char *sk)
+{
+  crypto_kem_expanded_sk esk;
+
+  crypto_kem_sk_expand(&esk, sk);
+  return crypto_kem_dec_expanded(ss, ct, &esk);
+}
+
+/*************************************************
+* Name:        crypto_kem_sk_expand
+*
+* Description: Prepares a secret key for repeated decapsulation:
+*              unpacks the secret vector, expands the embedded public
+*              key (including the transposed matrix used by the
+*              re-encryption check) and copies H(pk) and z out of sk
+*
+* Arguments:   - crypto_kem_expanded_sk *esk: pointer to output expanded secret key
+*              - const unsigned char *sk: pointer to input private key
+*                (an already allocated array of CRYPTO_SECRETKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_sk_expand(crypto_kem_expanded_sk *esk,
+                         const unsigned char *sk)
+{
+  size_t i;
+
+  indcpa_sk_expand(&esk->indcpa, sk);
+  indcpa_pk_expand(&esk->pk.indcpa, sk+KYBER_INDCPA_SECRETKEYBYTES);
+  for(i=0;i<KYBER_SYMBYTES;i++) {
+    esk->pk.hpk[i] = sk[KYBER_SECRETKEYBYTES-2*KYBER_SYMBYTES+i];
+    esk->z[i] = sk[KYBER_SECRETKEYBYTES-KYBER_SYMBYTES+i];
+  }
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_dec_expanded
+*
+* Description: Generates shared secret for given
+*              cipher text and expanded private key;
+*              output is identical to crypto_kem_dec
+*              on the original private key
+*
+* Arguments:   - unsigned char *ss: pointer to output shared secret
+*                (an already allocated array of CRYPTO_BYTES bytes)
+*              - const unsigned char *ct: pointer to input cipher text
+*                (an already allocated array of CRYPTO_CIPHERTEXTBYTES bytes)
+*              - const crypto_kem_expanded_sk *esk: pointer to input
+*                private key expanded by crypto_kem_sk_expand
+*
+* On failure, ss will contain a pseudo-random value.
+* Returns 0.
+**************************************************/
+int crypto_kem_dec_expanded(unsigned char *ss,
+                            const unsigned char *ct,
+                            const crypto_kem_expanded_sk *esk)
 {
   size_t i;
   int fail;
@@ -100,17 +297,16 @@ int crypto_kem_dec(unsigned char *ss,
   /* Will contain key, coins */
   uint8_t kr[2*KYBER_SYMBYTES];
   uint8_t cmp[KYBER_CIPHERTEXTBYTES];
-  const uint8_t *pk = sk+KYBER_INDCPA_SECRETKEYBYTES;
 
-  indcpa_dec(buf, ct, sk);
+  indcpa_dec_expanded(buf, ct, &esk->indcpa);
 
   /* Multitarget countermeasure for coins + contributory KEM */
   for(i=0;i<KYBER_SYMBYTES;i++)
-    buf[KYBER_SYMBYTES+i] = sk[KYBER_SECRETKEYBYTES-2*KYBER_SYMBYTES+i];
+    buf[KYBER_SYMBYTES+i] = esk->pk.hpk[i];
   hash_g(kr, buf, 2*KYBER_SYMBYTES);
 
   /* coins are in kr+KYBER_SYMBYTES */
-  indcpa_enc(cmp, buf, pk, kr+KYBER_SYMBYTES);
+  indcpa_enc_expanded(cmp, buf, &esk->pk.indcpa, kr+KYBER_SYMBYTES);
 
   fail = verify(ct, cmp, KYBER_CIPHERTEXTBYTES);
 
@@ -118,7 +314,7 @@ int crypto_kem_dec(unsigned char *ss,
   hash_h(kr+KYBER_SYMBYTES, ct, KYBER_CIPHERTEXTBYTES);
 
   /* Overwrite pre-k with z on re-encryption failure */
-  cmov(kr, sk+KYBER_SECRETKEYBYTES-KYBER_SYMBYTES, KYBER_SYMBYTES, fail);
+  cmov(kr, esk->z, KYBER_SYMBYTES, fail);
 
   /* hash concatenation of pre-k and H(c) to k */
   kdf(ss, kr, 2*KYBER_SYMBYTES);
@@ -0,0 +1,224 @@
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "params.h"
+#include "kem.h"
+#include "kempool.h"
+
+/*
+ * Keypair pool: a bounded ring of KYBER_POOL_SIZE slots, filled by one
+ * background worker and drained by any number of threads. Every slot
+ * carries a sequence number (bounded MPMC queue after D. Vyukov): a slot
+ * at ring position pos is free for the producer when seq == pos and holds
+ * a keypair for a consumer when seq == pos + 1. Consumers claim slots with
+ * a single CAS on head, so crypto_kem_keypair_pooled never blocks. The
+ * worker sleeps on a semaphore counting free slots while the ring is full.
+ *
+ * The worker calls randombytes() concurrently with the rest of the
+ * program, which therefore has to be thread-safe (rng.c serializes it).
+ */
+
+#define POOL_MASK ((size_t)KYBER_POOL_SIZE - 1)
+
+typedef struct {
+  atomic_size_t seq;
+  uint8_t pk[KYBER_PUBLICKEYBYTES];
+  uint8_t sk[KYBER_SECRETKEYBYTES];
+} pool_slot;
+
+static pool_slot pool[KYBER_POOL_SIZE];
+static atomic_size_t pool_head;   /* next position to hand out */
+static size_t pool_tail;          /* next position to fill, worker only */
+static sem_t pool_free;           /* number of free slots */
+static pthread_t pool_worker;
+static atomic_int pool_running;
+static atomic_int pool_stop;
+
+static atomic_uint_fast64_t pool_hits;
+static atomic_uint_fast64_t pool_misses;
+static atomic_uint_fast64_t pool_refills;
+static atomic_uint_fast64_t pool_refill_ns;
+
+static uint64_t monotonic_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/*************************************************
+* Name:        pool_fill
+*
+* Description: Body of the background worker: generates a keypair for
+*              every free slot and publishes it at the tail of the ring
+*
+* Arguments:   - void *arg: unused
+**************************************************/
+static void *pool_fill(void *arg)
+{
+  pool_slot *slot;
+  uint64_t t0;
+  uint8_t pk[KYBER_PUBLICKEYBYTES];
+  uint8_t sk[KYBER_SECRETKEYBYTES];
+  (void)arg;
+
+  for(;;) {
+    while(sem_wait(&pool_free) != 0 && errno == EINTR)
+      ;
+    if(atomic_load(&pool_stop))
+      break;
+
+    t0 = monotonic_ns();
+    crypto_kem_keypair(pk, sk);
+    atomic_fetch_add_explicit(&pool_refill_ns, monotonic_ns() - t0, memory_order_relaxed);
+
+    /* A consumer may still be copying out of this slot */
+    slot = &pool[pool_tail & POOL_MASK];
+    while(atomic_load_explicit(&slot->seq, memory_order_acquire) != pool_tail)
+      sched_yield();
+
+    memcpy(slot->pk, pk, KYBER_PUBLICKEYBYTES);
+    memcpy(slot->sk, sk, KYBER_SECRETKEYBYTES);
+    atomic_store_explicit(&slot->seq, pool_tail + 1, memory_order_release);
+    pool_tail++;
+    atomic_fetch_add_explicit(&pool_refills, 1, memory_order_relaxed);
+  }
+
+  memset(sk, 0, KYBER_SECRETKEYBYTES);
+  return NULL;
+}
+
+/*************************************************
+* Name:        crypto_kem_pool_start
+*
+* Description: Resets the keypair pool and starts its background worker.
+*              Must not run concurrently with other pool functions.
+*
+* Returns 0 on success (or if the pool is already running), -1 if the
+* worker thread could not be created
+**************************************************/
+int crypto_kem_pool_start(void)
+{
+  size_t i;
+
+  if(atomic_load(&pool_running))
+    return 0;
+
+  for(i=0;i<KYBER_POOL_SIZE;i++)
+    atomic_init(&pool[i].seq, i);
+  atomic_store(&pool_head, 0);
+  pool_tail = 0;
+  atomic_store(&pool_stop, 0);
+  atomic_store(&pool_hits, 0);
+  atomic_store(&pool_misses, 0);
+  atomic_store(&pool_refills, 0);
+  atomic_store(&pool_refill_ns, 0);
+
+  if(sem_init(&pool_free, 0, KYBER_POOL_SIZE) != 0)
+    return -1;
+  if(pthread_create(&pool_worker, NULL, pool_fill, NULL) != 0) {
+    sem_destroy(&pool_free);
+    return -1;
+  }
+
+  atomic_store(&pool_running, 1);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_kem_pool_stop
+*
+* Description: Stops the background worker and wipes all keypairs still
+*              held by the pool. Must not run concurrently with other
+*              pool functions; statistics remain readable afterwards.
+**************************************************/
+void crypto_kem_pool_stop(void)
+{
+  if(!atomic_load(&pool_running))
+    return;
+
+  atomic_store(&pool_stop, 1);
+  sem_post(&pool_free);
+  pthread_join(pool_worker, NULL);
+  sem_destroy(&pool_free);
+
+  memset(pool, 0, sizeof(pool));
+  atomic_store(&pool_running, 0);
+}
+
+/*************************************************
+* Name:        crypto_kem_keypair_pooled
+*
+* Description: Hands out a keypair from the pool in O(1) when the pool
+*              is not empty, or generates one with crypto_kem_keypair if
+*              the pool is empty or not running
+*
+* Arguments:   - unsigned char *pk: pointer to output public key
+*                (an already allocated array of CRYPTO_PUBLICKEYBYTES bytes)
+*              - unsigned char *sk: pointer to output private key
+*                (an already allocated array of CRYPTO_SECRETKEYBYTES bytes)
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_kem_keypair_pooled(unsigned char *pk, unsigned char *sk)
+{
+  size_t pos;
+  ptrdiff_t diff;
+  pool_slot *slot;
+
+  if(!atomic_load_explicit(&pool_running, memory_order_acquire))
+    goto miss;
+
+  pos = atomic_load_explicit(&pool_head, memory_order_relaxed);
+  for(;;) {
+    slot = &pool[pos & POOL_MASK];
+    diff = (ptrdiff_t)(atomic_load_explicit(&slot->seq, memory_order_acquire) - (pos + 1));
+    if(diff == 0) {
+      if(atomic_compare_exchange_weak_explicit(&pool_head, &pos, pos + 1,
+                                               memory_order_relaxed,
+                                               memory_order_relaxed))
+        break;
+    }
+    else if(diff < 0) {
+      goto miss;    /* not refilled yet */
+    }
+    else {
+      pos = atomic_load_explicit(&pool_head, memory_order_relaxed);
+    }
+  }
+
+  memcpy(pk, slot->pk, KYBER_PUBLICKEYBYTES);
+  memcpy(sk, slot->sk, KYBER_SECRETKEYBYTES);
+  memset(slot->sk, 0, KYBER_SECRETKEYBYTES);
+  atomic_store_explicit(&slot->seq, pos + KYBER_POOL_SIZE, memory_order_release);
+  sem_post(&pool_free);
+  atomic_fetch_add_explicit(&pool_hits, 1, memory_order_relaxed);
+  return 0;
+
+miss:
+  atomic_fetch_add_explicit(&pool_misses, 1, memory_order_relaxed);
+  return crypto_kem_keypair(pk, sk);
+}
+
+/*************************************************
+* Name:        crypto_kem_pool_get_stats
+*
+* Description: Reads the pool counters since the last crypto_kem_pool_start;
+*              the refill rate in keypairs per second is
+*              refills * 1e9 / refill_ns
+*
+* Arguments:   - crypto_kem_pool_stats *stats: pointer to output counters
+**************************************************/
+void crypto_kem_pool_get_stats(crypto_kem_pool_stats *stats)
+{
+  stats->hits = atomic_load_explicit(&pool_hits, memory_order_relaxed);
+  stats->misses = atomic_load_explicit(&pool_misses, memory_order_relaxed);
+  stats->refills = atomic_load_explicit(&pool_refills, memory_order_relaxed);
+  stats->refill_ns = atomic_load_explicit(&pool_refill_ns, memory_order_relaxed);
+}
@@ -0,0 +1,35 @@
+#ifndef KEMPOOL_H
+#define KEMPOOL_H
+
+#include <stdint.h>
+#include "params.h"
+
+/* Number of pre-generated keypairs kept by the pool, must be a power of 2 */
+#ifndef KYBER_POOL_SIZE
+#define KYBER_POOL_SIZE 16
+#endif
+
+#if KYBER_POOL_SIZE < 2 || (KYBER_POOL_SIZE & (KYBER_POOL_SIZE - 1)) != 0
+#error "KYBER_POOL_SIZE must be a power of 2 and at least 2"
+#endif
+
+typedef struct {
+  uint64_t hits;        /* keypairs handed out from the pool */
+  uint64_t misses;      /* keypairs generated inline because the pool was empty */
+  uint64_t refills;     /* keypairs generated by the background worker */
+  uint64_t refill_ns;   /* time the worker spent generating them */
+} crypto_kem_pool_stats;
+
+#define crypto_kem_pool_start KYBER_NAMESPACE(_pool_start)
+int crypto_kem_pool_start(void);
+
+#define crypto_kem_pool_stop KYBER_NAMESPACE(_pool_stop)
+void crypto_kem_pool_stop(void);
+
+#define crypto_kem_keypair_pooled KYBER_NAMESPACE(_keypair_pooled)
+int crypto_kem_keypair_pooled(unsigned char *pk, unsigned char *sk);
+
+#define crypto_kem_pool_get_stats KYBER_NAMESPACE(_pool_get_stats)
+void crypto_kem_pool_get_stats(crypto_kem_pool_stats *stats);
+
+#endif
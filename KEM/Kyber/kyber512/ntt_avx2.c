@@ -0,0 +1,314 @@
+#include <immintrin.h>
+#include <stdint.h>
+#include "params.h"
+#include "ntt.h"
+
+#ifdef KYBER_USE_AVX2
+#include "reduce_avx2.h"
+
+/*
+ * The three innermost layers (len = 8, 4, 2) only combine coefficients
+ * inside blocks of 32. Each such block is held in two registers and
+ * shuffled so that one register holds all upper and the other all lower
+ * butterfly inputs; zetas_avx2 and zetas_inv_avx2 hold the matching
+ * per-lane twiddle factors for each of the 8 blocks, 3 vectors per block.
+ * They were generated from zetas/zetas_inv in ntt.c as follows:
+
+  for(c = 0; c < 8; ++c) {
+    for(i = 0; i < 16; ++i) {
+      zetas_avx2[48*c+i]    = zetas[16 + 2*c + i/8];
+      zetas_avx2[48*c+16+i] = zetas[32 + 4*c + ((i/4 & 1) << 1 | i/8)];
+      zetas_avx2[48*c+32+i] = zetas[64 + 8*c + lane2[i/2]];
+      zetas_inv_avx2[48*c+i]    = zetas_inv[8*c + lane2[i/2]];
+      zetas_inv_avx2[48*c+16+i] = zetas_inv[64 + 4*c + ((i/4 & 1) << 1 | i/8)];
+      zetas_inv_avx2[48*c+32+i] = zetas_inv[96 + 2*c + i/8];
+    }
+  }
+
+ * with lane2[8] = {0, 1, 4, 5, 2, 3, 6, 7}.
+ */
+
+static const int16_t zetas_avx2[384] __attribute__((aligned(32))) = {
+  573, 573, 573, 573, 573, 573, 573, 573, 2004, 2004, 2004, 2004, 2004, 2004,
+  2004, 2004, 1223, 1223, 1223, 1223, 2777, 2777, 2777, 2777, 652, 652, 652,
+  652, 1015, 1015, 1015, 1015, 2226, 2226, 430, 430, 2078, 2078, 871, 871,
+  555, 555, 843, 843, 1550, 1550, 105, 105, 264, 264, 264, 264, 264, 264, 264,
+  264, 383, 383, 383, 383, 383, 383, 383, 383, 2036, 2036, 2036, 2036, 3047,
+  3047, 3047, 3047, 1491, 1491, 1491, 1491, 1785, 1785, 1785, 1785, 422, 422,
+  587, 587, 3038, 3038, 2869, 2869, 177, 177, 3094, 3094, 1574, 1574, 1653,
+  1653, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 2500, 1458, 1458, 1458,
+  1458, 1458, 1458, 1458, 1458, 516, 516, 516, 516, 3009, 3009, 3009, 3009,
+  3321, 3321, 3321, 3321, 2663, 2663, 2663, 2663, 3083, 3083, 778, 778, 2552,
+  2552, 1483, 1483, 1159, 1159, 3182, 3182, 2727, 2727, 1119, 1119, 1727,
+  1727, 1727, 1727, 1727, 1727, 1727, 1727, 3199, 3199, 3199, 3199, 3199,
+  3199, 3199, 3199, 1711, 1711, 1711, 1711, 126, 126, 126, 126, 2167, 2167,
+  2167, 2167, 1469, 1469, 1469, 1469, 1739, 1739, 644, 644, 418, 418, 329,
+  329, 2457, 2457, 349, 349, 3173, 3173, 3254, 3254, 2648, 2648, 2648, 2648,
+  2648, 2648, 2648, 2648, 1017, 1017, 1017, 1017, 1017, 1017, 1017, 1017,
+  2476, 2476, 2476, 2476, 3058, 3058, 3058, 3058, 3239, 3239, 3239, 3239, 830,
+  830, 830, 830, 817, 817, 1097, 1097, 1322, 1322, 2044, 2044, 603, 603, 610,
+  610, 1864, 1864, 384, 384, 732, 732, 732, 732, 732, 732, 732, 732, 608, 608,
+  608, 608, 608, 608, 608, 608, 107, 107, 107, 107, 3082, 3082, 3082, 3082,
+  1908, 1908, 1908, 1908, 2378, 2378, 2378, 2378, 2114, 2114, 3193, 3193,
+  2455, 2455, 220, 220, 1218, 1218, 1994, 1994, 2142, 2142, 1670, 1670, 1787,
+  1787, 1787, 1787, 1787, 1787, 1787, 1787, 411, 411, 411, 411, 411, 411, 411,
+  411, 2931, 2931, 2931, 2931, 1821, 1821, 1821, 1821, 961, 961, 961, 961,
+  2604, 2604, 2604, 2604, 2144, 2144, 1799, 1799, 1819, 1819, 2475, 2475,
+  2051, 2051, 794, 794, 2459, 2459, 478, 478, 3124, 3124, 3124, 3124, 3124,
+  3124, 3124, 3124, 1758, 1758, 1758, 1758, 1758, 1758, 1758, 1758, 448, 448,
+  448, 448, 677, 677, 677, 677, 2264, 2264, 2264, 2264, 2054, 2054, 2054,
+  2054, 3221, 3221, 3021, 3021, 958, 958, 1869, 1869, 996, 996, 991, 991,
+  1522, 1522, 1628, 1628
+};
+
+static const int16_t zetas_inv_avx2[384] __attribute__((aligned(32))) = {
+  1701, 1701, 1807, 1807, 2338, 2338, 2333, 2333, 1460, 1460, 2371, 2371, 308,
+  308, 108, 108, 1275, 1275, 1275, 1275, 1065, 1065, 1065, 1065, 2652, 2652,
+  2652, 2652, 2881, 2881, 2881, 2881, 1571, 1571, 1571, 1571, 1571, 1571,
+  1571, 1571, 205, 205, 205, 205, 205, 205, 205, 205, 2851, 2851, 870, 870,
+  2535, 2535, 1278, 1278, 854, 854, 1510, 1510, 1530, 1530, 1185, 1185, 725,
+  725, 725, 725, 2368, 2368, 2368, 2368, 1508, 1508, 1508, 1508, 398, 398,
+  398, 398, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 2918, 1542, 1542, 1542,
+  1542, 1542, 1542, 1542, 1542, 1659, 1659, 1187, 1187, 1335, 1335, 2111,
+  2111, 3109, 3109, 874, 874, 136, 136, 1215, 1215, 951, 951, 951, 951, 1421,
+  1421, 1421, 1421, 247, 247, 247, 247, 3222, 3222, 3222, 3222, 2721, 2721,
+  2721, 2721, 2721, 2721, 2721, 2721, 2597, 2597, 2597, 2597, 2597, 2597,
+  2597, 2597, 2945, 2945, 1465, 1465, 2719, 2719, 2726, 2726, 1285, 1285,
+  2007, 2007, 2232, 2232, 2512, 2512, 2499, 2499, 2499, 2499, 90, 90, 90, 90,
+  271, 271, 271, 271, 853, 853, 853, 853, 2312, 2312, 2312, 2312, 2312, 2312,
+  2312, 2312, 681, 681, 681, 681, 681, 681, 681, 681, 75, 75, 156, 156, 2980,
+  2980, 872, 872, 3000, 3000, 2911, 2911, 2685, 2685, 1590, 1590, 1860, 1860,
+  1860, 1860, 1162, 1162, 1162, 1162, 3203, 3203, 3203, 3203, 1618, 1618,
+  1618, 1618, 130, 130, 130, 130, 130, 130, 130, 130, 1602, 1602, 1602, 1602,
+  1602, 1602, 1602, 1602, 2210, 2210, 602, 602, 147, 147, 2170, 2170, 1846,
+  1846, 777, 777, 2551, 2551, 246, 246, 666, 666, 666, 666, 8, 8, 8, 8, 320,
+  320, 320, 320, 2813, 2813, 2813, 2813, 1871, 1871, 1871, 1871, 1871, 1871,
+  1871, 1871, 829, 829, 829, 829, 829, 829, 829, 829, 1676, 1676, 1755, 1755,
+  235, 235, 3152, 3152, 460, 460, 291, 291, 2742, 2742, 2907, 2907, 1544,
+  1544, 1544, 1544, 1838, 1838, 1838, 1838, 282, 282, 282, 282, 1293, 1293,
+  1293, 1293, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 2946, 3065, 3065,
+  3065, 3065, 3065, 3065, 3065, 3065, 3224, 3224, 1779, 1779, 2486, 2486,
+  2774, 2774, 2458, 2458, 1251, 1251, 2899, 2899, 1103, 1103, 2314, 2314,
+  2314, 2314, 2677, 2677, 2677, 2677, 552, 552, 552, 552, 2106, 2106, 2106,
+  2106, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 2756, 2756, 2756,
+  2756, 2756, 2756, 2756, 2756
+};
+
+/*************************************************
+* Name:        shuffle8
+*
+* Description: Regroup two registers of 16 coefficients so that a holds the
+*              upper and b the lower inputs of the len = 8 butterflies;
+*              the operation is its own inverse
+**************************************************/
+static inline void shuffle8(__m256i *a, __m256i *b)
+{
+  __m256i t = _mm256_permute2x128_si256(*a, *b, 0x20);
+  *b = _mm256_permute2x128_si256(*a, *b, 0x31);
+  *a = t;
+}
+
+/*************************************************
+* Name:        shuffle4
+*
+* Description: Same as shuffle8 for the len = 4 butterflies
+**************************************************/
+static inline void shuffle4(__m256i *a, __m256i *b)
+{
+  __m256i t = _mm256_unpacklo_epi64(*a, *b);
+  *b = _mm256_unpackhi_epi64(*a, *b);
+  *a = t;
+}
+
+/*************************************************
+* Name:        shuffle2
+*
+* Description: Same as shuffle8 for the len = 2 butterflies; shuffle2_inv
+*              undoes it
+**************************************************/
+static inline void shuffle2(__m256i *a, __m256i *b)
+{
+  __m256i s = _mm256_shuffle_epi32(*a, 0xD8);
+  __m256i t = _mm256_shuffle_epi32(*b, 0xD8);
+  *a = _mm256_unpacklo_epi64(s, t);
+  *b = _mm256_unpackhi_epi64(s, t);
+}
+
+static inline void shuffle2_inv(__m256i *a, __m256i *b)
+{
+  __m256i s = _mm256_unpacklo_epi64(*a, *b);
+  __m256i t = _mm256_unpackhi_epi64(*a, *b);
+  *a = _mm256_shuffle_epi32(s, 0xD8);
+  *b = _mm256_shuffle_epi32(t, 0xD8);
+}
+
+/*************************************************
+* Name:        butterfly
+*
+* Description: Cooley-Tukey butterfly of the forward NTT:
+*              (a, b) -> (a + zeta*b, a - zeta*b)
+**************************************************/
+static inline void butterfly(__m256i *a, __m256i *b, __m256i zeta)
+{
+  __m256i t = fqmul_avx2(zeta, *b);
+  *b = _mm256_sub_epi16(*a, t);
+  *a = _mm256_add_epi16(*a, t);
+}
+
+/*************************************************
+* Name:        butterfly_inv
+*
+* Description: Gentleman-Sande butterfly of the inverse NTT:
+*              (a, b) -> (barrett(a + b), zeta*(a - b))
+**************************************************/
+static inline void butterfly_inv(__m256i *a, __m256i *b, __m256i zeta)
+{
+  __m256i t = *a;
+  *a = barrett_reduce_avx2(_mm256_add_epi16(t, *b));
+  *b = fqmul_avx2(zeta, _mm256_sub_epi16(t, *b));
+}
+
+/*************************************************
+* Name:        ntt_avx2
+*
+* Description: AVX2 version of ntt; produces exactly the same output
+*
+* Arguments:   - int16_t r[256]: pointer to input/output vector of elements
+*                                of Zq
+**************************************************/
+void ntt_avx2(int16_t r[256])
+{
+  unsigned int len, start, j, k;
+  __m256i zeta, a, b;
+  const __m256i *zv = (const __m256i *)zetas_avx2;
+
+  k = 1;
+  for(len = 128; len >= 16; len >>= 1) {
+    for(start = 0; start < 256; start = j + len) {
+      zeta = _mm256_set1_epi16(zetas[k++]);
+      for(j = start; j < start + len; j += 16) {
+        a = _mm256_loadu_si256((__m256i *)&r[j]);
+        b = _mm256_loadu_si256((__m256i *)&r[j + len]);
+        butterfly(&a, &b, zeta);
+        _mm256_storeu_si256((__m256i *)&r[j], a);
+        _mm256_storeu_si256((__m256i *)&r[j + len], b);
+      }
+    }
+  }
+
+  for(start = 0; start < 256; start += 32) {
+    a = _mm256_loadu_si256((__m256i *)&r[start]);
+    b = _mm256_loadu_si256((__m256i *)&r[start + 16]);
+
+    shuffle8(&a, &b);
+    butterfly(&a, &b, _mm256_load_si256(zv++));
+    shuffle8(&a, &b);
+
+    shuffle4(&a, &b);
+    butterfly(&a, &b, _mm256_load_si256(zv++));
+    shuffle4(&a, &b);
+
+    shuffle2(&a, &b);
+    butterfly(&a, &b, _mm256_load_si256(zv++));
+    shuffle2_inv(&a, &b);
+
+    _mm256_storeu_si256((__m256i *)&r[start], a);
+    _mm256_storeu_si256((__m256i *)&r[start + 16], b);
+  }
+}
+
+/*************************************************
+* Name:        invntt_avx2
+*
+* Description: AVX2 version of invntt; produces exactly the same output
+*
+* Arguments:   - int16_t r[256]: pointer to input/output vector of elements
+*                                of Zq
+**************************************************/
+void invntt_avx2(int16_t r[256])
+{
+  unsigned int len, start, j, k;
+  __m256i zeta, a, b;
+  const __m256i *zv = (const __m256i *)zetas_inv_avx2;
+
+  for(start = 0; start < 256; start += 32) {
+    a = _mm256_loadu_si256((__m256i *)&r[start]);
+    b = _mm256_loadu_si256((__m256i *)&r[start + 16]);
+
+    shuffle2(&a, &b);
+    butterfly_inv(&a, &b, _mm256_load_si256(zv++));
+    shuffle2_inv(&a, &b);
+
+    shuffle4(&a, &b);
+    butterfly_inv(&a, &b, _mm256_load_si256(zv++));
+    shuffle4(&a, &b);
+
+    shuffle8(&a, &b);
+    butterfly_inv(&a, &b, _mm256_load_si256(zv++));
+    shuffle8(&a, &b);
+
+    _mm256_storeu_si256((__m256i *)&r[start], a);
+    _mm256_storeu_si256((__m256i *)&r[start + 16], b);
+  }
+
+  k = 112;
+  for(len = 16; len <= 128; len <<= 1) {
+    for(start = 0; start < 256; start = j + len) {
+      zeta = _mm256_set1_epi16(zetas_inv[k++]);
+      for(j = start; j < start + len; j += 16) {
+        a = _mm256_loadu_si256((__m256i *)&r[j]);
+        b = _mm256_loadu_si256((__m256i *)&r[j + len]);
+        butterfly_inv(&a, &b, zeta);
+        _mm256_storeu_si256((__m256i *)&r[j], a);
+        _mm256_storeu_si256((__m256i *)&r[j + len], b);
+      }
+    }
+  }
+
+  zeta = _mm256_set1_epi16(zetas_inv[127]);
+  for(j = 0; j < 256; j += 16) {
+    a = _mm256_loadu_si256((__m256i *)&r[j]);
+    _mm256_storeu_si256((__m256i *)&r[j], fqmul_avx2(a, zeta));
+  }
+}
+
+/*************************************************
+* Name:        basemul_avx2
+*
+* Description: AVX2 version of the 128 calls to basemul made by
+*              poly_basemul_montgomery; coefficients are processed in
+*              (a0, a1) pairs held in adjacent 16-bit lanes
+*
+* Arguments:   - int16_t r[256]:       pointer to the output polynomial
+*              - const int16_t a[256]: pointer to the first factor
+*              - const int16_t b[256]: pointer to the second factor
+**************************************************/
+void basemul_avx2(int16_t r[256], const int16_t a[256], const int16_t b[256])
+{
+  unsigned int i;
+  __m256i va, vb, p, q, z, t;
+  const __m256i swap = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5,
+                                        10, 11, 8, 9, 14, 15, 12, 13,
+                                        2, 3, 0, 1, 6, 7, 4, 5,
+                                        10, 11, 8, 9, 14, 15, 12, 13);
+
+  for(i = 0; i < KYBER_N/16; i++) {
+    /* lanes (2m, 2m+1) of z are (0, zeta) resp. (0, -zeta) */
+    t = _mm256_cvtepu16_epi64(_mm_loadl_epi64((__m128i *)&zetas[64 + 4*i]));
+    z = _mm256_sub_epi16(_mm256_setzero_si256(), t);
+    z = _mm256_or_si256(_mm256_slli_epi64(t, 16), _mm256_slli_epi64(z, 48));
+
+    va = _mm256_loadu_si256((__m256i *)&a[16*i]);
+    vb = _mm256_loadu_si256((__m256i *)&b[16*i]);
+
+    p = fqmul_avx2(va, vb);                           /* a0*b0, a1*b1 */
+    q = fqmul_avx2(va, _mm256_shuffle_epi8(vb, swap)); /* a0*b1, a1*b0 */
+    q = _mm256_add_epi16(q, _mm256_shuffle_epi8(q, swap));
+    t = fqmul_avx2(p, z);
+    p = _mm256_add_epi16(_mm256_shuffle_epi8(t, swap), p);
+
+    _mm256_storeu_si256((__m256i *)&r[16*i], _mm256_blend_epi16(p, q, 0xAA));
+  }
+}
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef PACK_AVX2_H
+#define PACK_AVX2_H
+
+#include <stdint.h>
+#include "params.h"
+#include "poly.h"
+#include "polyvec.h"
+
+#ifdef KYBER_USE_AVX2
+/*
+ * The inputs of the compression and serialization routines must already
+ * be reduced to {0,...,q-1} (see poly_csubq); the outputs are byte-for-byte
+ * identical to the scalar code in poly.c and polyvec.c.
+ */
+#define poly_compress_avx2 KYBER_NAMESPACE(_poly_compress_avx2)
+void poly_compress_avx2(uint8_t r[KYBER_POLYCOMPRESSEDBYTES], const poly *a);
+#define poly_decompress_avx2 KYBER_NAMESPACE(_poly_decompress_avx2)
+void poly_decompress_avx2(poly *r, const uint8_t a[KYBER_POLYCOMPRESSEDBYTES]);
+
+#define poly_tobytes_avx2 KYBER_NAMESPACE(_poly_tobytes_avx2)
+void poly_tobytes_avx2(uint8_t r[KYBER_POLYBYTES], const poly *a);
+#define poly_frombytes_avx2 KYBER_NAMESPACE(_poly_frombytes_avx2)
+void poly_frombytes_avx2(poly *r, const uint8_t a[KYBER_POLYBYTES]);
+
+#define polyvec_compress_avx2 KYBER_NAMESPACE(_polyvec_compress_avx2)
+void polyvec_compress_avx2(uint8_t r[KYBER_POLYVECCOMPRESSEDBYTES],
+                           const polyvec *a);
+#define polyvec_decompress_avx2 KYBER_NAMESPACE(_polyvec_decompress_avx2)
+void polyvec_decompress_avx2(polyvec *r,
+                             const uint8_t a[KYBER_POLYVECCOMPRESSEDBYTES]);
+#endif
+
+#endif
@@ -7,6 +7,12 @@
 
 //#define KYBER_90S	/* Uncomment this if you want the 90S variant */
 
+/* Use the AVX2 kernels whenever the compiler targets AVX2 (-march=native
+ * on a capable host); define KYBER_NO_AVX2 to force the reference code */
+#if defined(__AVX2__) && !defined(KYBER_NO_AVX2)
+#define KYBER_USE_AVX2
+#endif
+
 /* Don't change parameters below this line */
 #if   (KYBER_K == 2)
 #ifdef KYBER_90S
@@ -4,14 +4,27 @@
 #include <sys/sysinfo.h>  // 内存信息
 #include <string.h>       // 字符串处理
 #include <stdint.h>       // uint64_t 类型
+#include <sched.h>        // sched_yield
 
 // 项目原有头文件
 #include "./api.h"
+#include "kem.h"          // 预展开公钥接口
+#include "kempool.h"      // 密钥对池
 #include "cpucycles.h"
 
 // 测试次数（1000次）
 #define TEST_ROUNDS 1000
 
+// 批量封装测试：每个批大小下共封装 BATCH_TOTAL 次，重复 BATCH_REPS 轮
+#define BATCH_MAX   64
+#define BATCH_TOTAL 256
+#define BATCH_REPS  15
+
+static unsigned char batch_pk[BATCH_MAX][CRYPTO_PUBLICKEYBYTES];
+static unsigned char batch_sk[CRYPTO_SECRETKEYBYTES];
+static unsigned char batch_ct[BATCH_MAX][CRYPTO_CIPHERTEXTBYTES];
+static unsigned char batch_ss[BATCH_MAX][CRYPTO_BYTES];
+
 // 排序函数：用于计算中位数（qsort 依赖）
 int compare_uint64(const void *a, const void *b) {
     return (*(uint64_t *)a - *(uint64_t *)b);
@@ -98,6 +111,57 @@ static void calc_stats(uint64_t *data, int len,
     }
 }
 
+// 函数：批量封装吞吐量测试（逐个调用 crypto_kem_enc 与 crypto_kem_enc_batch 对比）
+static void bench_enc_batch(double cpu_freq) {
+    static const size_t batch_sizes[] = {1, 4, 16, 64};
+    unsigned char *ct[BATCH_MAX];
+    unsigned char *ss[BATCH_MAX];
+    const unsigned char *pk[BATCH_MAX];
+    uint64_t loop_cycles[BATCH_REPS], batch_cycles[BATCH_REPS];
+
+    for (int i = 0; i < BATCH_MAX; i++) {
+        crypto_kem_keypair(batch_pk[i], batch_sk);
+        ct[i] = batch_ct[i];
+        ss[i] = batch_ss[i];
+        pk[i] = batch_pk[i];
+    }
+
+    printf("=======================================================================\n");
+    printf("                      %s 批量封装吞吐量                  \n", CRYPTO_ALGNAME);
+    printf("=======================================================================\n");
+    printf("%-8s | %-14s | %-14s | %-16s\n",
+           "批大小", "逐个(周期/次)", "批量(周期/次)", "批量吞吐量(次/秒)");
+    printf("-----------------------------------------------------------------------\n");
+    for (size_t b = 0; b < sizeof(batch_sizes)/sizeof(batch_sizes[0]); b++) {
+        size_t n = batch_sizes[b];
+        for (int r = 0; r < BATCH_REPS; r++) {
+            uint64_t start = cpucycles();
+            for (size_t k = 0; k < BATCH_TOTAL; k += n)
+                for (size_t i = 0; i < n; i++)
+                    crypto_kem_enc(ct[i], ss[i], pk[i]);
+            loop_cycles[r] = (cpucycles() - start) / BATCH_TOTAL;
+
+            start = cpucycles();
+            for (size_t k = 0; k < BATCH_TOTAL; k += n)
+                crypto_kem_enc_batch(ct, ss, pk, n);
+            batch_cycles[r] = (cpucycles() - start) / BATCH_TOTAL;
+        }
+
+        double avg;
+        uint64_t loop_med, batch_med, min, max;
+        calc_stats(loop_cycles, BATCH_REPS, &avg, &loop_med, &min, &max);
+        calc_stats(batch_cycles, BATCH_REPS, &avg, &batch_med, &min, &max);
+        if (cpu_freq > 0) {
+            printf("%-8zu | %-14lu | %-14lu | %-16.0f\n",
+                   n, loop_med, batch_med, cpu_freq * 1e6 / batch_med);
+        } else {
+            printf("%-8zu | %-14lu | %-14lu | %-16s\n",
+                   n, loop_med, batch_med, "N/A");
+        }
+    }
+    printf("=======================================================================\n");
+}
+
 // 辅助函数：将周期数换算为ms
 static double cycles_to_ms(uint64_t cycles, double cpu_freq) {
     if (cpu_freq <= 0) return -1.0;
@@ -113,10 +177,16 @@ int main() {
     unsigned char ct[CRYPTO_CIPHERTEXTBYTES];
     unsigned char key1[CRYPTO_BYTES];
     unsigned char key2[CRYPTO_BYTES];
+    crypto_kem_expanded_pk epk;
+    crypto_kem_expanded_sk esk;
+    crypto_kem_pool_stats pool_stats;
 
     uint64_t keypair_cycles[TEST_ROUNDS] = {0};
+    uint64_t keypair_pool_cycles[TEST_ROUNDS] = {0};
     uint64_t enc_cycles[TEST_ROUNDS] = {0};
+    uint64_t enc_exp_cycles[TEST_ROUNDS] = {0};
     uint64_t dec_cycles[TEST_ROUNDS] = {0};
+    uint64_t dec_exp_cycles[TEST_ROUNDS] = {0};
 
     crypto_kem_keypair(pk, sk);
     crypto_kem_enc(ct, key1, pk);
@@ -136,36 +206,89 @@ int main() {
         end = cpucycles();
         enc_cycles[i] = end - start;
 
+        // 公钥只展开一次，之后的加密复用（不计入计时）
+        crypto_kem_pk_expand(&epk, pk);
+        start = cpucycles();
+        crypto_kem_enc_expanded(ct, key1, &epk);
+        end = cpucycles();
+        enc_exp_cycles[i] = end - start;
+
         start = cpucycles();
         crypto_kem_dec(key2, ct, sk);
         end = cpucycles();
         dec_cycles[i] = end - start;
+
+        // 私钥只展开一次，之后的解密复用（不计入计时）
+        crypto_kem_sk_expand(&esk, sk);
+        start = cpucycles();
+        crypto_kem_dec_expanded(key2, ct, &esk);
+        end = cpucycles();
+        dec_exp_cycles[i] = end - start;
     }
 
-    double kp_avg_cy, enc_avg_cy, dec_avg_cy;
-    uint64_t kp_med_cy, enc_med_cy, dec_med_cy;
-    uint64_t kp_min_cy, enc_min_cy, dec_min_cy;
-    uint64_t kp_max_cy, enc_max_cy, dec_max_cy;
+    // 密钥对池单独计时：后台线程只在这段循环中运行，不影响上面各项的结果
+    crypto_kem_pool_start();
+    for (int i = 0; i < TEST_ROUNDS; i++) {
+        uint64_t start, end;
+
+        // 等待池中有可用的密钥对（模拟两次请求之间的空闲），只计取出的耗时
+        do {
+            sched_yield();
+            crypto_kem_pool_get_stats(&pool_stats);
+        } while (pool_stats.refills <= pool_stats.hits);
+
+        start = cpucycles();
+        crypto_kem_keypair_pooled(pk, sk);
+        end = cpucycles();
+        keypair_pool_cycles[i] = end - start;
+    }
+    crypto_kem_pool_stop();
+    crypto_kem_pool_get_stats(&pool_stats);
+
+    double kpp_avg_cy;
+    uint64_t kpp_med_cy, kpp_min_cy, kpp_max_cy;
+    double kp_avg_cy, enc_avg_cy, encx_avg_cy, dec_avg_cy, decx_avg_cy;
+    uint64_t kp_med_cy, enc_med_cy, encx_med_cy, dec_med_cy, decx_med_cy;
+    uint64_t kp_min_cy, enc_min_cy, encx_min_cy, dec_min_cy, decx_min_cy;
+    uint64_t kp_max_cy, enc_max_cy, encx_max_cy, dec_max_cy, decx_max_cy;
 
     calc_stats(keypair_cycles, TEST_ROUNDS, &kp_avg_cy, &kp_med_cy, &kp_min_cy, &kp_max_cy);
+    calc_stats(keypair_pool_cycles, TEST_ROUNDS, &kpp_avg_cy, &kpp_med_cy, &kpp_min_cy, &kpp_max_cy);
     calc_stats(enc_cycles, TEST_ROUNDS, &enc_avg_cy, &enc_med_cy, &enc_min_cy, &enc_max_cy);
+    calc_stats(enc_exp_cycles, TEST_ROUNDS, &encx_avg_cy, &encx_med_cy, &encx_min_cy, &encx_max_cy);
     calc_stats(dec_cycles, TEST_ROUNDS, &dec_avg_cy, &dec_med_cy, &dec_min_cy, &dec_max_cy);
+    calc_stats(dec_exp_cycles, TEST_ROUNDS, &decx_avg_cy, &decx_med_cy, &decx_min_cy, &decx_max_cy);
 
     double kp_avg_ms = cycles_to_ms((uint64_t)kp_avg_cy, cpu_freq);
     double kp_med_ms = cycles_to_ms(kp_med_cy, cpu_freq);
     double kp_min_ms = cycles_to_ms(kp_min_cy, cpu_freq);
     double kp_max_ms = cycles_to_ms(kp_max_cy, cpu_freq);
 
+    double kpp_avg_ms = cycles_to_ms((uint64_t)kpp_avg_cy, cpu_freq);
+    double kpp_med_ms = cycles_to_ms(kpp_med_cy, cpu_freq);
+    double kpp_min_ms = cycles_to_ms(kpp_min_cy, cpu_freq);
+    double kpp_max_ms = cycles_to_ms(kpp_max_cy, cpu_freq);
+
     double enc_avg_ms = cycles_to_ms((uint64_t)enc_avg_cy, cpu_freq);
     double enc_med_ms = cycles_to_ms(enc_med_cy, cpu_freq);
     double enc_min_ms = cycles_to_ms(enc_min_cy, cpu_freq);
     double enc_max_ms = cycles_to_ms(enc_max_cy, cpu_freq);
 
+    double encx_avg_ms = cycles_to_ms((uint64_t)encx_avg_cy, cpu_freq);
+    double encx_med_ms = cycles_to_ms(encx_med_cy, cpu_freq);
+    double encx_min_ms = cycles_to_ms(encx_min_cy, cpu_freq);
+    double encx_max_ms = cycles_to_ms(encx_max_cy, cpu_freq);
+
     double dec_avg_ms = cycles_to_ms((uint64_t)dec_avg_cy, cpu_freq);
     double dec_med_ms = cycles_to_ms(dec_med_cy, cpu_freq);
     double dec_min_ms = cycles_to_ms(dec_min_cy, cpu_freq);
     double dec_max_ms = cycles_to_ms(dec_max_cy, cpu_freq);
 
+    double decx_avg_ms = cycles_to_ms((uint64_t)decx_avg_cy, cpu_freq);
+    double decx_med_ms = cycles_to_ms(decx_med_cy, cpu_freq);
+    double decx_min_ms = cycles_to_ms(decx_min_cy, cpu_freq);
+    double decx_max_ms = cycles_to_ms(decx_max_cy, cpu_freq);
+
     printf("=======================================================================\n");
     printf("                      Kyber-512 性能测试结果（周期数）          \n");
     printf("=======================================================================\n");
@@ -174,10 +297,16 @@ int main() {
     printf("-------------------------------------------------------------\n");
     printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
            "密钥对生成", kp_avg_cy, kp_med_cy, kp_min_cy, kp_max_cy);
+    printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
+           "密钥对生成(池)", kpp_avg_cy, kpp_med_cy, kpp_min_cy, kpp_max_cy);
     printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
            "加密", enc_avg_cy, enc_med_cy, enc_min_cy, enc_max_cy);
+    printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
+           "加密(预展开)", encx_avg_cy, encx_med_cy, encx_min_cy, encx_max_cy);
     printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
            "解密", dec_avg_cy, dec_med_cy, dec_min_cy, dec_max_cy);
+    printf("%-15s | %-12.0f | %-12lu | %-12lu | %-12lu\n", 
+           "解密(预展开)", decx_avg_cy, decx_med_cy, decx_min_cy, decx_max_cy);
     printf("=======================================================================\n");
 
     printf("=======================================================================\n");
@@ -189,21 +318,44 @@ int main() {
     if (cpu_freq > 0) {
         printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
                "密钥对生成", kp_avg_ms, kp_med_ms, kp_min_ms, kp_max_ms);
+        printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
+               "密钥对生成(池)", kpp_avg_ms, kpp_med_ms, kpp_min_ms, kpp_max_ms);
         printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
                "加密", enc_avg_ms, enc_med_ms, enc_min_ms, enc_max_ms);
+        printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
+               "加密(预展开)", encx_avg_ms, encx_med_ms, encx_min_ms, encx_max_ms);
         printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
                "解密", dec_avg_ms, dec_med_ms, dec_min_ms, dec_max_ms);
+        printf("%-15s | %-12.6f | %-12.6f | %-12.6f | %-12.6f\n", 
+               "解密(预展开)", decx_avg_ms, decx_med_ms, decx_min_ms, decx_max_ms);
     } else {
         printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
                "密钥对生成", "N/A", "N/A", "N/A", "N/A");
+        printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
+               "密钥对生成(池)", "N/A", "N/A", "N/A", "N/A");
         printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
                "加密", "N/A", "N/A", "N/A", "N/A");
+        printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
+               "加密(预展开)", "N/A", "N/A", "N/A", "N/A");
         printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
                "解密", "N/A", "N/A", "N/A", "N/A");
+        printf("%-15s | %-12s | %-12s | %-12s | %-12s\n", 
+               "解密(预展开)", "N/A", "N/A", "N/A", "N/A");
         printf("\n⚠️  提示：CPU频率获取失败，无法换算时间（ms）\n");
     }
     printf("=======================================================================\n");
 
+    // 密钥对池统计（后台生成速率 = 生成个数 / 生成耗时）
+    printf("密钥对池: 命中 %llu 次, 未命中 %llu 次, 后台生成 %llu 个",
+           (unsigned long long)pool_stats.hits, (unsigned long long)pool_stats.misses,
+           (unsigned long long)pool_stats.refills);
+    if (pool_stats.refill_ns > 0) {
+        printf(", 生成速率 %.0f 个/秒", pool_stats.refills * 1e9 / pool_stats.refill_ns);
+    }
+    printf("\n\n");
+
+    bench_enc_batch(cpu_freq);
+
     if (memcmp(key1, key2, CRYPTO_BYTES) != 0) {
         printf("\n⚠️  警告：最后一次测试中，加密密钥与解密密钥不匹配！\n");
     } else {
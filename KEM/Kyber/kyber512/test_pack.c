@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "api.h"
+#include "params.h"
+#include "poly.h"
+#include "polyvec.h"
+#include "rng.h"
+
+#define NTESTS 1000
+#define GUARD 32
+
+#define POLY_COMPRESS_BITS (KYBER_POLYCOMPRESSEDBYTES/32)
+#define POLYVEC_COMPRESS_BITS (KYBER_POLYVECCOMPRESSEDBYTES/(32*KYBER_K))
+
+/*
+ * Reference serialization: d-bit values in little-endian bit order, with
+ * the rounding formulas of the scalar code in poly.c and polyvec.c. The
+ * library functions (scalar or AVX2, depending on the build) have to
+ * produce exactly the same bytes and coefficients.
+ */
+static uint16_t ref_compress(int16_t x, unsigned int d)
+{
+  return ((((uint32_t)x << d) + KYBER_Q/2)/KYBER_Q) & ((1U << d) - 1);
+}
+
+static int16_t ref_decompress(uint16_t t, unsigned int d)
+{
+  return ((uint32_t)t*KYBER_Q + (1U << (d-1))) >> d;
+}
+
+static void ref_pack(uint8_t *r, const poly *a, unsigned int d, int compress)
+{
+  unsigned int i, j, pos = 0;
+  uint16_t t;
+
+  memset(r, 0, 32*d);
+  for(i=0;i<KYBER_N;i++) {
+    t = compress ? ref_compress(a->coeffs[i], d) : (uint16_t)a->coeffs[i];
+    for(j=0;j<d;j++,pos++)
+      r[pos/8] |= ((t >> j) & 1) << (pos%8);
+  }
+}
+
+static void ref_unpack(poly *r, const uint8_t *a, unsigned int d, int decompress)
+{
+  unsigned int i, j, pos = 0;
+  uint16_t t;
+
+  for(i=0;i<KYBER_N;i++) {
+    t = 0;
+    for(j=0;j<d;j++,pos++)
+      t |= ((a[pos/8] >> (pos%8)) & 1) << j;
+    r->coeffs[i] = decompress ? ref_decompress(t, d) : (int16_t)t;
+  }
+}
+
+/* Coefficients in {0,...,2q-1}, as accepted by poly_csubq */
+static void random_poly(poly *a)
+{
+  unsigned int i;
+  uint16_t buf[KYBER_N];
+
+  randombytes((unsigned char *)buf, sizeof(buf));
+  for(i=0;i<KYBER_N;i++)
+    a->coeffs[i] = buf[i] % (2*KYBER_Q);
+}
+
+static int check_guard(const uint8_t *buf, size_t len)
+{
+  size_t i;
+  for(i=0;i<GUARD;i++)
+    if(buf[len+i] != 0xA5)
+      return 1;
+  return 0;
+}
+
+static int test_poly(const poly *in)
+{
+  poly a, b, c;
+  uint8_t buf[KYBER_POLYBYTES + GUARD], ref[KYBER_POLYBYTES];
+  unsigned int i;
+  int err = 0;
+
+  /* compress/decompress */
+  a = *in;
+  memset(buf, 0xA5, sizeof(buf));
+  poly_compress(buf, &a);
+  poly_csubq(&a);
+  ref_pack(ref, &a, POLY_COMPRESS_BITS, 1);
+  err |= memcmp(buf, ref, KYBER_POLYCOMPRESSEDBYTES) != 0;
+  err |= check_guard(buf, KYBER_POLYCOMPRESSEDBYTES);
+
+  poly_decompress(&b, buf);
+  ref_unpack(&c, buf, POLY_COMPRESS_BITS, 1);
+  err |= memcmp(&b, &c, sizeof(poly)) != 0;
+
+  /* decompression is a right inverse of compression */
+  poly_compress(ref, &b);
+  err |= memcmp(buf, ref, KYBER_POLYCOMPRESSEDBYTES) != 0;
+
+  /* tobytes/frombytes */
+  a = *in;
+  memset(buf, 0xA5, sizeof(buf));
+  poly_tobytes(buf, &a);
+  poly_csubq(&a);
+  ref_pack(ref, &a, 12, 0);
+  err |= memcmp(buf, ref, KYBER_POLYBYTES) != 0;
+  err |= check_guard(buf, KYBER_POLYBYTES);
+
+  poly_frombytes(&b, buf);
+  err |= memcmp(&a, &b, sizeof(poly)) != 0;
+
+  /* frombytes keeps 12 bits of arbitrary input */
+  randombytes(buf, KYBER_POLYBYTES);
+  poly_frombytes(&b, buf);
+  ref_unpack(&c, buf, 12, 0);
+  err |= memcmp(&b, &c, sizeof(poly)) != 0;
+
+  for(i=0;i<KYBER_N;i++)
+    err |= b.coeffs[i] < 0 || b.coeffs[i] > 4095;
+
+  return err;
+}
+
+static int test_polyvec(const polyvec *in)
+{
+  polyvec a, b;
+  poly c;
+  uint8_t buf[KYBER_POLYVECCOMPRESSEDBYTES + GUARD];
+  uint8_t ref[KYBER_POLYVECCOMPRESSEDBYTES];
+  unsigned int i;
+  int err = 0;
+
+  a = *in;
+  memset(buf, 0xA5, sizeof(buf));
+  polyvec_compress(buf, &a);
+  polyvec_csubq(&a);
+  for(i=0;i<KYBER_K;i++)
+    ref_pack(&ref[32*POLYVEC_COMPRESS_BITS*i], &a.vec[i],
+             POLYVEC_COMPRESS_BITS, 1);
+  err |= memcmp(buf, ref, KYBER_POLYVECCOMPRESSEDBYTES) != 0;
+  err |= check_guard(buf, KYBER_POLYVECCOMPRESSEDBYTES);
+
+  polyvec_decompress(&b, buf);
+  for(i=0;i<KYBER_K;i++) {
+    ref_unpack(&c, &buf[32*POLYVEC_COMPRESS_BITS*i], POLYVEC_COMPRESS_BITS, 1);
+    err |= memcmp(&b.vec[i], &c, sizeof(poly)) != 0;
+  }
+
+  polyvec_compress(ref, &b);
+  err |= memcmp(buf, ref, KYBER_POLYVECCOMPRESSEDBYTES) != 0;
+
+  return err;
+}
+
+int main(void)
+{
+  unsigned int i, j;
+  unsigned char seed[48];
+  poly a;
+  polyvec v;
+  int err = 0;
+
+  for(i=0;i<48;i++)
+    seed[i] = i;
+  randombytes_init(seed, NULL, 256);
+
+  /* every coefficient value in {0,...,2q-1} */
+  for(i=0;i<2*KYBER_Q;i+=KYBER_N) {
+    for(j=0;j<KYBER_N;j++)
+      a.coeffs[j] = (i + j) % (2*KYBER_Q);
+    err |= test_poly(&a);
+    for(j=0;j<KYBER_K;j++)
+      v.vec[j] = a;
+    err |= test_polyvec(&v);
+  }
+
+  for(i=0;i<NTESTS;i++) {
+    random_poly(&a);
+    err |= test_poly(&a);
+    for(j=0;j<KYBER_K;j++)
+      random_poly(&v.vec[j]);
+    err |= test_polyvec(&v);
+  }
+
+  printf("%s pack/unpack: %s\n", CRYPTO_ALGNAME, err ? "FAILED" : "OK");
+  return err;
+}
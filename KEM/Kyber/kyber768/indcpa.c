@@ -7,6 +7,12 @@
 #include "rng.h"
 #include "ntt.h"
 #include "symmetric.h"
+#ifdef KYBER_USE_AVX2
+#include "rejsample_avx2.h"
+#ifndef KYBER_90S
+#include "fips202x4.h"
+#endif
+#endif
 
 /*************************************************
 * Name:        pack_pk
@@ -141,6 +147,9 @@ static unsigned int rej_uniform(int16_t *r,
   uint16_t val0, val1;
 
   ctr = pos = 0;
+#ifdef KYBER_USE_AVX2
+  ctr = rej_uniform_avx2(r, len, buf, buflen, &pos);
+#endif
   while(ctr < len && pos + 3 <= buflen) {
     val0 = ((buf[pos+0] >> 0) | ((uint16_t)buf[pos+1] << 8)) & 0xFFF;
     val1 = ((buf[pos+1] >> 4) | ((uint16_t)buf[pos+2] << 4)) & 0xFFF;
@@ -158,6 +167,101 @@ static unsigned int rej_uniform(int16_t *r,
 #define gen_a(A,B)  gen_matrix(A,B,0)
 #define gen_at(A,B) gen_matrix(A,B,1)
 
+#define GEN_MATRIX_NBLOCKS ((12*KYBER_N/8*(1 << 12)/KYBER_Q \
+                             + XOF_BLOCKBYTES)/XOF_BLOCKBYTES)
+
+/*************************************************
+* Name:        gen_matrix_entry
+*
+* Description: Deterministically generate one entry of matrix A from a seed
+*              and the two domain-separation bytes x and y
+*
+* Arguments:   - poly *r:             pointer to output polynomial
+*              - const uint8_t *seed: pointer to input seed
+*              - uint8_t x:           first byte appended to the seed
+*              - uint8_t y:           second byte appended to the seed
+**************************************************/
+static void gen_matrix_entry(poly *r,
+                             const uint8_t seed[KYBER_SYMBYTES],
+                             uint8_t x,
+                             uint8_t y)
+{
+  unsigned int ctr, k;
+  unsigned int buflen, off;
+  uint8_t buf[GEN_MATRIX_NBLOCKS*XOF_BLOCKBYTES+2];
+  xof_state state;
+
+  xof_absorb(&state, seed, x, y);
+
+  xof_squeezeblocks(buf, GEN_MATRIX_NBLOCKS, &state);
+  buflen = GEN_MATRIX_NBLOCKS*XOF_BLOCKBYTES;
+  ctr = rej_uniform(r->coeffs, KYBER_N, buf, buflen);
+
+  while(ctr < KYBER_N) {
+    off = buflen % 3;
+    for(k = 0; k < off; k++)
+      buf[k] = buf[buflen - off + k];
+    xof_squeezeblocks(buf + off, 1, &state);
+    buflen = off + XOF_BLOCKBYTES;
+    ctr += rej_uniform(r->coeffs + ctr, KYBER_N - ctr, buf, buflen);
+  }
+}
+
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+/*************************************************
+* Name:        gen_matrix_entry_x4
+*
+* Description: Generate four entries of matrix A at once with four
+*              interleaved SHAKE128 instances; the result equals four calls
+*              to gen_matrix_entry
+*
+* Arguments:   - poly **r:            pointers to the four output polynomials
+*              - const uint8_t *seed: pointer to input seed
+*              - const uint8_t *x:    first bytes appended to the seed
+*              - const uint8_t *y:    second bytes appended to the seed
+**************************************************/
+static void gen_matrix_entry_x4(poly *r[4],
+                                const uint8_t seed[KYBER_SYMBYTES],
+                                const uint8_t x[4],
+                                const uint8_t y[4])
+{
+  unsigned int ctr[4], i, k;
+  unsigned int buflen, off;
+  uint8_t buf[4][GEN_MATRIX_NBLOCKS*XOF_BLOCKBYTES+2];
+  uint8_t extseed[4][KYBER_SYMBYTES+2];
+  keccakx4_state state;
+
+  for(i = 0; i < 4; i++) {
+    for(k = 0; k < KYBER_SYMBYTES; k++)
+      extseed[i][k] = seed[k];
+    extseed[i][KYBER_SYMBYTES+0] = x[i];
+    extseed[i][KYBER_SYMBYTES+1] = y[i];
+  }
+
+  shake128x4_absorb(&state, extseed[0], extseed[1], extseed[2], extseed[3],
+                    KYBER_SYMBYTES+2);
+  shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                           GEN_MATRIX_NBLOCKS, &state);
+  buflen = GEN_MATRIX_NBLOCKS*XOF_BLOCKBYTES;
+  for(i = 0; i < 4; i++)
+    ctr[i] = rej_uniform(r[i]->coeffs, KYBER_N, buf[i], buflen);
+
+  while(ctr[0] < KYBER_N || ctr[1] < KYBER_N
+        || ctr[2] < KYBER_N || ctr[3] < KYBER_N) {
+    off = buflen % 3;
+    for(i = 0; i < 4; i++)
+      for(k = 0; k < off; k++)
+        buf[i][k] = buf[i][buflen - off + k];
+    shake128x4_squeezeblocks(buf[0] + off, buf[1] + off, buf[2] + off,
+                             buf[3] + off, 1, &state);
+    buflen = off + XOF_BLOCKBYTES;
+    for(i = 0; i < 4; i++)
+      ctr[i] += rej_uniform(r[i]->coeffs + ctr[i], KYBER_N - ctr[i],
+                            buf[i], buflen);
+  }
+}
+#endif
+
 /*************************************************
 * Name:        gen_matrix
 *
@@ -171,36 +275,43 @@ static unsigned int rej_uniform(int16_t *r,
 *              - int transposed:      boolean deciding whether A or A^T
 *                                     is generated
 **************************************************/
-#define GEN_MATRIX_NBLOCKS ((12*KYBER_N/8*(1 << 12)/KYBER_Q \
-                             + XOF_BLOCKBYTES)/XOF_BLOCKBYTES)
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+#define GEN_MATRIX_X4_ENTRIES (KYBER_K*KYBER_K & ~3U)
+#else
+#define GEN_MATRIX_X4_ENTRIES 0
+#endif
+
 // Not static for benchmarking
 void gen_matrix(polyvec *a, const uint8_t seed[KYBER_SYMBYTES], int transposed)
 {
-  unsigned int ctr, i, j, k;
-  unsigned int buflen, off;
-  uint8_t buf[GEN_MATRIX_NBLOCKS*XOF_BLOCKBYTES+2];
-  xof_state state;
-
-  for(i=0;i<KYBER_K;i++) {
-    for(j=0;j<KYBER_K;j++) {
-      if(transposed)
-        xof_absorb(&state, seed, i, j);
-      else
-        xof_absorb(&state, seed, j, i);
-
-      xof_squeezeblocks(buf, GEN_MATRIX_NBLOCKS, &state);
-      buflen = GEN_MATRIX_NBLOCKS*XOF_BLOCKBYTES;
-      ctr = rej_uniform(a[i].vec[j].coeffs, KYBER_N, buf, buflen);
-
-      while(ctr < KYBER_N) {
-        off = buflen % 3;
-        for(k = 0; k < off; k++)
-          buf[k] = buf[buflen - off + k];
-        xof_squeezeblocks(buf + off, 1, &state);
-        buflen = off + XOF_BLOCKBYTES;
-        ctr += rej_uniform(a[i].vec[j].coeffs + ctr, KYBER_N - ctr, buf, buflen);
-      }
+  unsigned int n, i, j;
+
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+  unsigned int l;
+  poly *r[4];
+  uint8_t x[4], y[4];
+
+  /* Entries are taken four at a time in row-major order */
+  for(n = 0; n < GEN_MATRIX_X4_ENTRIES; n += 4) {
+    for(l = 0; l < 4; l++) {
+      i = (n + l) / KYBER_K;
+      j = (n + l) % KYBER_K;
+      r[l] = &a[i].vec[j];
+      x[l] = transposed ? i : j;
+      y[l] = transposed ? j : i;
     }
+    gen_matrix_entry_x4(r, seed, x, y);
+  }
+#endif
+
+  /* Entries left over by the 4-way XOF, or all of them without it */
+  for(n = GEN_MATRIX_X4_ENTRIES; n < KYBER_K*KYBER_K; n++) {
+    i = n / KYBER_K;
+    j = n % KYBER_K;
+    if(transposed)
+      gen_matrix_entry(&a[i].vec[j], seed, i, j);
+    else
+      gen_matrix_entry(&a[i].vec[j], seed, j, i);
   }
 }
 
@@ -222,7 +333,6 @@ void indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
   uint8_t buf[2*KYBER_SYMBYTES];
   const uint8_t *publicseed = buf;
   const uint8_t *noiseseed = buf+KYBER_SYMBYTES;
-  uint8_t nonce = 0;
   polyvec a[KYBER_K], e, pkpv, skpv;
 
   randombytes(buf, KYBER_SYMBYTES);
@@ -230,10 +340,16 @@ void indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
 
   gen_a(a, publicseed);
 
-  for(i=0;i<KYBER_K;i++)
-    poly_getnoise_eta1(&skpv.vec[i], noiseseed, nonce++);
-  for(i=0;i<KYBER_K;i++)
-    poly_getnoise_eta1(&e.vec[i], noiseseed, nonce++);
+  // nonces 0..K-1 for s, K..2K-1 for e
+#if KYBER_K == 2
+  poly_getnoise_eta1_4x(skpv.vec+0, skpv.vec+1, e.vec+0, e.vec+1, noiseseed, 0, 1, 2, 3);
+#elif KYBER_K == 3
+  poly_getnoise_eta1_4x(skpv.vec+0, skpv.vec+1, skpv.vec+2, e.vec+0, noiseseed, 0, 1, 2, 3);
+  poly_getnoise_eta1_4x(e.vec+1, e.vec+2, NULL, NULL, noiseseed, 4, 5, 0, 0);
+#elif KYBER_K == 4
+  poly_getnoise_eta1_4x(skpv.vec+0, skpv.vec+1, skpv.vec+2, skpv.vec+3, noiseseed, 0, 1, 2, 3);
+  poly_getnoise_eta1_4x(e.vec+0, e.vec+1, e.vec+2, e.vec+3, noiseseed, 4, 5, 6, 7);
+#endif
 
   polyvec_ntt(&skpv);
   polyvec_ntt(&e);
@@ -251,6 +367,88 @@ void indcpa_keypair(uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
   pack_pk(pk, &pkpv, publicseed);
 }
 
+/*************************************************
+* Name:        indcpa_pk_expand
+*
+* Description: Unpacks a public key of the CPA-secure public-key
+*              encryption scheme and expands its transposed matrix,
+*              i.e. performs all work of indcpa_enc that only depends
+*              on the public key.
+*
+* Arguments:   - indcpa_expanded_pk *epk: pointer to output expanded public key
+*              - const uint8_t *pk:       pointer to input public key
+*                                         (of length KYBER_INDCPA_PUBLICKEYBYTES)
+**************************************************/
+void indcpa_pk_expand(indcpa_expanded_pk *epk,
+                      const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES])
+{
+  uint8_t seed[KYBER_SYMBYTES];
+
+  unpack_pk(&epk->pkpv, seed, pk);
+  gen_at(epk->at, seed);
+}
+
+/*************************************************
+* Name:        indcpa_enc_expanded
+*
+* Description: Encryption function of the CPA-secure
+*              public-key encryption scheme underlying Kyber,
+*              using a public key expanded by indcpa_pk_expand.
+*
+* Arguments:   - uint8_t *c:                     pointer to output ciphertext
+*                                                (of length KYBER_INDCPA_BYTES bytes)
+*              - const uint8_t *m:               pointer to input message
+*                                                (of length KYBER_INDCPA_MSGBYTES bytes)
+*              - const indcpa_expanded_pk *epk:  pointer to input expanded public key
+*              - const uint8_t *coins:           pointer to input random coins
+*                                                used as seed (of length KYBER_SYMBYTES)
+*                                                to deterministically generate all
+*                                                randomness
+**************************************************/
+void indcpa_enc_expanded(uint8_t c[KYBER_INDCPA_BYTES],
+                         const uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const indcpa_expanded_pk *epk,
+                         const uint8_t coins[KYBER_SYMBYTES])
+{
+  unsigned int i;
+  polyvec sp, ep, bp;
+  poly v, k, epp;
+
+  poly_frommsg(&k, m);
+
+  // nonces 0..K-1 for r, K..2K-1 for e1, 2K for e2
+#if KYBER_K == 2
+  poly_getnoise_eta1_4x(sp.vec+0, sp.vec+1, NULL, NULL, coins, 0, 1, 0, 0);
+  poly_getnoise_eta2_4x(ep.vec+0, ep.vec+1, &epp, NULL, coins, 2, 3, 4, 0);
+#elif KYBER_K == 3
+  poly_getnoise_eta1_4x(sp.vec+0, sp.vec+1, sp.vec+2, NULL, coins, 0, 1, 2, 0);
+  poly_getnoise_eta2_4x(ep.vec+0, ep.vec+1, ep.vec+2, &epp, coins, 3, 4, 5, 6);
+#elif KYBER_K == 4
+  poly_getnoise_eta1_4x(sp.vec+0, sp.vec+1, sp.vec+2, sp.vec+3, coins, 0, 1, 2, 3);
+  poly_getnoise_eta2_4x(ep.vec+0, ep.vec+1, ep.vec+2, ep.vec+3, coins, 4, 5, 6, 7);
+  poly_getnoise_eta2(&epp, coins, 8);
+#endif
+
+  polyvec_ntt(&sp);
+
+  // matrix-vector multiplication
+  for(i=0;i<KYBER_K;i++)
+    polyvec_pointwise_acc_montgomery(&bp.vec[i], &epk->at[i], &sp);
+
+  polyvec_pointwise_acc_montgomery(&v, &epk->pkpv, &sp);
+
+  polyvec_invntt_tomont(&bp);
+  poly_invntt_tomont(&v);
+
+  polyvec_add(&bp, &bp, &ep);
+  poly_add(&v, &v, &epp);
+  poly_add(&v, &v, &k);
+  polyvec_reduce(&bp);
+  poly_reduce(&v);
+
+  pack_ciphertext(c, &bp, &v);
+}
+
 /*************************************************
 * Name:        indcpa_enc
 *
@@ -273,40 +471,58 @@ void indcpa_enc(uint8_t c[KYBER_INDCPA_BYTES],
                 const uint8_t pk[KYBER_INDCPA_PUBLICKEYBYTES],
                 const uint8_t coins[KYBER_SYMBYTES])
 {
-  unsigned int i;
-  uint8_t seed[KYBER_SYMBYTES];
-  uint8_t nonce = 0;
-  polyvec sp, pkpv, ep, at[KYBER_K], bp;
-  poly v, k, epp;
-
-  unpack_pk(&pkpv, seed, pk);
-  poly_frommsg(&k, m);
-  gen_at(at, seed);
+  indcpa_expanded_pk epk;
 
-  for(i=0;i<KYBER_K;i++)
-    poly_getnoise_eta1(sp.vec+i, coins, nonce++);
-  for(i=0;i<KYBER_K;i++)
-    poly_getnoise_eta2(ep.vec+i, coins, nonce++);
-  poly_getnoise_eta2(&epp, coins, nonce++);
+  indcpa_pk_expand(&epk, pk);
+  indcpa_enc_expanded(c, m, &epk, coins);
+}
 
-  polyvec_ntt(&sp);
+/*************************************************
+* Name:        indcpa_sk_expand
+*
+* Description: Unpacks a secret key of the CPA-secure public-key
+*              encryption scheme once for repeated decryption
+*
+* Arguments:   - indcpa_expanded_sk *esk: pointer to output expanded secret key
+*              - const uint8_t *sk:       pointer to input secret key
+*                                         (of length KYBER_INDCPA_SECRETKEYBYTES)
+**************************************************/
+void indcpa_sk_expand(indcpa_expanded_sk *esk,
+                      const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
+{
+  unpack_sk(&esk->skpv, sk);
+}
 
-  // matrix-vector multiplication
-  for(i=0;i<KYBER_K;i++)
-    polyvec_pointwise_acc_montgomery(&bp.vec[i], &at[i], &sp);
+/*************************************************
+* Name:        indcpa_dec_expanded
+*
+* Description: Decryption function of the CPA-secure
+*              public-key encryption scheme underlying Kyber,
+*              using a secret key expanded by indcpa_sk_expand.
+*
+* Arguments:   - uint8_t *m:                    pointer to output decrypted message
+*                                               (of length KYBER_INDCPA_MSGBYTES)
+*              - const uint8_t *c:              pointer to input ciphertext
+*                                               (of length KYBER_INDCPA_BYTES)
+*              - const indcpa_expanded_sk *esk: pointer to input expanded secret key
+**************************************************/
+void indcpa_dec_expanded(uint8_t m[KYBER_INDCPA_MSGBYTES],
+                         const uint8_t c[KYBER_INDCPA_BYTES],
+                         const indcpa_expanded_sk *esk)
+{
+  polyvec bp;
+  poly v, mp;
 
-  polyvec_pointwise_acc_montgomery(&v, &pkpv, &sp);
+  unpack_ciphertext(&bp, &v, c);
 
-  polyvec_invntt_tomont(&bp);
-  poly_invntt_tomont(&v);
+  polyvec_ntt(&bp);
+  polyvec_pointwise_acc_montgomery(&mp, &esk->skpv, &bp);
+  poly_invntt_tomont(&mp);
 
-  polyvec_add(&bp, &bp, &ep);
-  poly_add(&v, &v, &epp);
-  poly_add(&v, &v, &k);
-  polyvec_reduce(&bp);
-  poly_reduce(&v);
+  poly_sub(&mp, &v, &mp);
+  poly_reduce(&mp);
 
-  pack_ciphertext(c, &bp, &v);
+  poly_tomsg(m, &mp);
 }
 
 /*************************************************
@@ -326,18 +542,8 @@ void indcpa_dec(uint8_t m[KYBER_INDCPA_MSGBYTES],
                 const uint8_t c[KYBER_INDCPA_BYTES],
                 const uint8_t sk[KYBER_INDCPA_SECRETKEYBYTES])
 {
-  polyvec bp, skpv;
-  poly v, mp;
-
-  unpack_ciphertext(&bp, &v, c);
-  unpack_sk(&skpv, sk);
-
-  polyvec_ntt(&bp);
-  polyvec_pointwise_acc_montgomery(&mp, &skpv, &bp);
-  poly_invntt_tomont(&mp);
+  indcpa_expanded_sk esk;
 
-  poly_sub(&mp, &v, &mp);
-  poly_reduce(&mp);
-
-  poly_tomsg(m, &mp);
+  indcpa_sk_expand(&esk, sk);
+  indcpa_dec_expanded(m, c, &esk);
 }
@@ -1,7 +1,10 @@
 #ifndef KEM_H
 #define KEM_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include "params.h"
+#include "indcpa.h"
 
 #define crypto_kem_keypair KYBER_NAMESPACE(_keypair)
 int crypto_kem_keypair(unsigned char *pk, unsigned char *sk);
@@ -11,9 +14,46 @@ int crypto_kem_enc(unsigned char *ct,
                    unsigned char *ss,
                    const unsigned char *pk);
 
+/* Public key prepared once for repeated encapsulation, see crypto_kem_pk_expand */
+typedef struct {
+  indcpa_expanded_pk indcpa;
+  uint8_t hpk[KYBER_SYMBYTES];    /* H(pk) */
+} crypto_kem_expanded_pk;
+
+#define crypto_kem_pk_expand KYBER_NAMESPACE(_pk_expand)
+int crypto_kem_pk_expand(crypto_kem_expanded_pk *epk,
+                         const unsigned char *pk);
+
+#define crypto_kem_enc_expanded KYBER_NAMESPACE(_enc_expanded)
+int crypto_kem_enc_expanded(unsigned char *ct,
+                            unsigned char *ss,
+                            const crypto_kem_expanded_pk *epk);
+
+#define crypto_kem_enc_batch KYBER_NAMESPACE(_enc_batch)
+int crypto_kem_enc_batch(unsigned char *const ct[],
+                         unsigned char *const ss[],
+                         const unsigned char *const pk[],
+                         size_t n);
+
 #define crypto_kem_dec KYBER_NAMESPACE(_dec)
 int crypto_kem_dec(unsigned char *ss,
                    const unsigned char *ct,
                    const unsigned char *sk);
 
+/* Secret key prepared once for repeated decapsulation, see crypto_kem_sk_expand */
+typedef struct {
+  indcpa_expanded_sk indcpa;
+  crypto_kem_expanded_pk pk;      /* embedded public key, for re-encryption */
+  uint8_t z[KYBER_SYMBYTES];      /* implicit-rejection secret */
+} crypto_kem_expanded_sk;
+
+#define crypto_kem_sk_expand KYBER_NAMESPACE(_sk_expand)
+int crypto_kem_sk_expand(crypto_kem_expanded_sk *esk,
+                         const unsigned char *sk);
+
+#define crypto_kem_dec_expanded KYBER_NAMESPACE(_dec_expanded)
+int crypto_kem_dec_expanded(unsigned char *ss,
+                            const unsigned char *ct,
+                            const crypto_kem_expanded_sk *esk);
+
 #endif
@@ -0,0 +1,323 @@
+#include <stdint.h>
+#include <string.h>
+#include <immintrin.h>
+#include "params.h"
+#include "poly.h"
+#include "polyvec.h"
+#include "pack_avx2.h"
+
+#ifdef KYBER_USE_AVX2
+
+#define POLY_COMPRESS_BITS (KYBER_POLYCOMPRESSEDBYTES/32)
+#define POLYVEC_COMPRESS_BITS (KYBER_POLYVECCOMPRESSEDBYTES/(32*KYBER_K))
+
+/*************************************************
+* Name:        compress_avx2
+*
+* Description: Lane-wise compression to d bits; equivalent to
+*              ((x << d) + q/2)/q & (2^d - 1) for x in {0,...,q-1}.
+*              The approximate quotient floor(x*2^14/q) obtained from
+*              a multiply-high with round(2^26/q) exceeds the exact one
+*              by at most 1, which is detected from the sign of the
+*              (16-bit exact) remainder and corrected.
+*
+* Arguments:   - __m256i x:        input coefficients in {0,...,q-1}
+*              - unsigned int d:   number of output bits, at most 13
+*
+* Returns compressed coefficients in {0,...,2^d - 1}
+**************************************************/
+static inline __m256i compress_avx2(__m256i x, const unsigned int d)
+{
+  const __m256i v = _mm256_set1_epi16(((1U << 26) + KYBER_Q/2)/KYBER_Q);
+  const __m256i q = _mm256_set1_epi16(KYBER_Q);
+  __m256i f, t;
+
+  f = _mm256_mulhi_epu16(_mm256_slli_epi16(x, 4), v);
+  t = _mm256_mullo_epi16(f, q);
+  t = _mm256_sub_epi16(t, _mm256_slli_epi16(x, 14));
+  t = _mm256_cmpgt_epi16(t, _mm256_setzero_si256());
+  f = _mm256_add_epi16(f, t);
+
+  f = _mm256_add_epi16(f, _mm256_set1_epi16(1 << (13 - d)));
+  f = _mm256_srli_epi16(f, 14 - d);
+  return _mm256_and_si256(f, _mm256_set1_epi16((1 << d) - 1));
+}
+
+/*************************************************
+* Name:        decompress_avx2
+*
+* Description: Lane-wise decompression from d bits; equivalent to
+*              (t*q + 2^(d-1)) >> d
+*
+* Arguments:   - __m256i t:        compressed coefficients in {0,...,2^d - 1}
+*              - unsigned int d:   number of input bits, between 1 and 15
+*
+* Returns coefficients in {0,...,q-1}
+**************************************************/
+static inline __m256i decompress_avx2(__m256i t, const unsigned int d)
+{
+  t = _mm256_slli_epi16(t, 15 - d);
+  return _mm256_mulhrs_epi16(t, _mm256_set1_epi16(KYBER_Q));
+}
+
+/*************************************************
+* Name:        pack16
+*
+* Description: Serialize 16 d-bit values in little-endian bit order into
+*              2*d bytes. Writes 16 bytes at r and r+d; everything past
+*              r+2*d is zero and has to be overwritten or discarded by the
+*              caller.
+*
+* Arguments:   - uint8_t *r:     pointer to output byte array
+*                                (needs space for d+16 bytes)
+*              - __m256i t:      values in {0,...,2^d - 1}
+*              - unsigned int d: number of bits per value, at most 12
+**************************************************/
+static inline void pack16(uint8_t *r, __m256i t, const unsigned int d)
+{
+  __m256i f, h;
+
+  // 32-bit lanes hold 2*d bits
+  f = _mm256_madd_epi16(t, _mm256_set1_epi32(((1 << d) << 16) | 1));
+  // 64-bit lanes hold 4*d bits
+  f = _mm256_sllv_epi32(f, _mm256_set1_epi64x(32 - 2*d));
+  f = _mm256_srlv_epi64(f, _mm256_set1_epi64x(32 - 2*d));
+  // 128-bit lanes hold 8*d bits
+  h = _mm256_unpackhi_epi64(f, f);
+  f = _mm256_blend_epi32(f, _mm256_setzero_si256(), 0xCC);
+  f = _mm256_or_si256(f, _mm256_sllv_epi64(h, _mm256_set_epi64x(64, 4*d, 64, 4*d)));
+  f = _mm256_or_si256(f, _mm256_srlv_epi64(h, _mm256_set_epi64x(64 - 4*d, 64, 64 - 4*d, 64)));
+
+  _mm_storeu_si128((__m128i *)r, _mm256_castsi256_si128(f));
+  _mm_storeu_si128((__m128i *)(r + d), _mm256_extracti128_si256(f, 1));
+}
+
+#define UNPACK_IDX(d, k) ((int)((((k)*(d)) >> 3)*0x01010101U + 0x03020100U))
+#define UNPACK_SHIFT(d, k) ((int)(((k)*(d)) & 7))
+
+/*************************************************
+* Name:        unpack8
+*
+* Description: Deserialize 8 d-bit values into 32-bit lanes; every lane
+*              gathers the 4 bytes its bits start in and shifts them down
+*
+* Arguments:   - const uint8_t *a: pointer to input byte array
+*                                  (reads 16 bytes)
+*              - unsigned int d:   number of bits per value, at most 12
+*
+* Returns values in {0,...,2^d - 1}
+**************************************************/
+static inline __m256i unpack8(const uint8_t *a, const unsigned int d)
+{
+  const __m256i idx = _mm256_setr_epi32(UNPACK_IDX(d,0), UNPACK_IDX(d,1),
+                                        UNPACK_IDX(d,2), UNPACK_IDX(d,3),
+                                        UNPACK_IDX(d,4), UNPACK_IDX(d,5),
+                                        UNPACK_IDX(d,6), UNPACK_IDX(d,7));
+  const __m256i shift = _mm256_setr_epi32(UNPACK_SHIFT(d,0), UNPACK_SHIFT(d,1),
+                                          UNPACK_SHIFT(d,2), UNPACK_SHIFT(d,3),
+                                          UNPACK_SHIFT(d,4), UNPACK_SHIFT(d,5),
+                                          UNPACK_SHIFT(d,6), UNPACK_SHIFT(d,7));
+  __m256i f;
+
+  f = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)a));
+  f = _mm256_shuffle_epi8(f, idx);
+  f = _mm256_srlv_epi32(f, shift);
+  return _mm256_and_si256(f, _mm256_set1_epi32((1 << d) - 1));
+}
+
+/*************************************************
+* Name:        unpack16
+*
+* Description: Inverse of pack16; deserialize 16 d-bit values from
+*              2*d bytes
+*
+* Arguments:   - const uint8_t *a: pointer to input byte array
+*                                  (reads d+16 bytes)
+*              - unsigned int d:   number of bits per value, at most 12
+*
+* Returns values in {0,...,2^d - 1} in 16-bit lanes
+**************************************************/
+static inline __m256i unpack16(const uint8_t *a, const unsigned int d)
+{
+  __m256i f0, f1;
+
+  f0 = unpack8(a, d);
+  f1 = unpack8(a + d, d);
+  f0 = _mm256_packus_epi32(f0, f1);
+  return _mm256_permute4x64_epi64(f0, 0xD8);
+}
+
+/*************************************************
+* Name:        pack_poly
+*
+* Description: Optionally compress and then serialize all coefficients
+*              of a polynomial to d bits each. Blocks whose stores would
+*              reach past r+32*d go through a buffer.
+*
+* Arguments:   - uint8_t *r:       pointer to output byte array
+*                                  (needs space for 32*d bytes)
+*              - const poly *a:    pointer to input polynomial with
+*                                  coefficients in {0,...,q-1}
+*              - unsigned int d:   number of bits per coefficient
+*              - int compress:     whether to compress before packing
+**************************************************/
+static inline void pack_poly(uint8_t *r,
+                             const poly *a,
+                             const unsigned int d,
+                             const int compress)
+{
+  unsigned int i;
+  __m256i f;
+  uint8_t buf[32];
+
+  for(i=0;i<KYBER_N/16;i++) {
+    f = _mm256_loadu_si256((const __m256i *)&a->coeffs[16*i]);
+    if(compress)
+      f = compress_avx2(f, d);
+
+    if(2*d*i + d + 16 <= 32*d)
+      pack16(&r[2*d*i], f, d);
+    else {
+      pack16(buf, f, d);
+      memcpy(&r[2*d*i], buf, 2*d);
+    }
+  }
+}
+
+/*************************************************
+* Name:        unpack_poly
+*
+* Description: Deserialize all coefficients of a polynomial from d bits
+*              each and optionally decompress them. Blocks whose loads
+*              would reach past a+32*d go through a buffer.
+*
+* Arguments:   - poly *r:           pointer to output polynomial
+*              - const uint8_t *a:  pointer to input byte array
+*                                   (of length 32*d bytes)
+*              - unsigned int d:    number of bits per coefficient
+*              - int decompress:    whether to decompress after unpacking
+**************************************************/
+static inline void unpack_poly(poly *r,
+                               const uint8_t *a,
+                               const unsigned int d,
+                               const int decompress)
+{
+  unsigned int i;
+  __m256i f;
+  uint8_t buf[32] = {0};
+
+  for(i=0;i<KYBER_N/16;i++) {
+    if(2*d*i + d + 16 <= 32*d)
+      f = unpack16(&a[2*d*i], d);
+    else {
+      memcpy(buf, &a[2*d*i], 2*d);
+      f = unpack16(buf, d);
+    }
+
+    if(decompress)
+      f = decompress_avx2(f, d);
+    _mm256_storeu_si256((__m256i *)&r->coeffs[16*i], f);
+  }
+}
+
+/*************************************************
+* Name:        poly_compress_avx2
+*
+* Description: Compression and subsequent serialization of a polynomial;
+*              same output as poly_compress
+*
+* Arguments:   - uint8_t *r:    pointer to output byte array
+*                               (of length KYBER_POLYCOMPRESSEDBYTES)
+*              - const poly *a: pointer to input polynomial with
+*                               coefficients in {0,...,q-1}
+**************************************************/
+void poly_compress_avx2(uint8_t r[KYBER_POLYCOMPRESSEDBYTES], const poly *a)
+{
+  pack_poly(r, a, POLY_COMPRESS_BITS, 1);
+}
+
+/*************************************************
+* Name:        poly_decompress_avx2
+*
+* Description: De-serialization and subsequent decompression of a
+*              polynomial; same output as poly_decompress
+*
+* Arguments:   - poly *r:          pointer to output polynomial
+*              - const uint8_t *a: pointer to input byte array
+*                                  (of length KYBER_POLYCOMPRESSEDBYTES bytes)
+**************************************************/
+void poly_decompress_avx2(poly *r, const uint8_t a[KYBER_POLYCOMPRESSEDBYTES])
+{
+  unpack_poly(r, a, POLY_COMPRESS_BITS, 1);
+}
+
+/*************************************************
+* Name:        poly_tobytes_avx2
+*
+* Description: Serialization of a polynomial; same output as poly_tobytes
+*
+* Arguments:   - uint8_t *r:    pointer to output byte array
+*                               (needs space for KYBER_POLYBYTES bytes)
+*              - const poly *a: pointer to input polynomial with
+*                               coefficients in {0,...,q-1}
+**************************************************/
+void poly_tobytes_avx2(uint8_t r[KYBER_POLYBYTES], const poly *a)
+{
+  pack_poly(r, a, 12, 0);
+}
+
+/*************************************************
+* Name:        poly_frombytes_avx2
+*
+* Description: De-serialization of a polynomial; same output as
+*              poly_frombytes
+*
+* Arguments:   - poly *r:          pointer to output polynomial
+*              - const uint8_t *a: pointer to input byte array
+*                                  (of KYBER_POLYBYTES bytes)
+**************************************************/
+void poly_frombytes_avx2(poly *r, const uint8_t a[KYBER_POLYBYTES])
+{
+  unpack_poly(r, a, 12, 0);
+}
+
+/*************************************************
+* Name:        polyvec_compress_avx2
+*
+* Description: Compress and serialize vector of polynomials; same output
+*              as polyvec_compress
+*
+* Arguments:   - uint8_t *r:       pointer to output byte array
+*                                  (needs space for KYBER_POLYVECCOMPRESSEDBYTES)
+*              - const polyvec *a: pointer to input vector of polynomials
+*                                  with coefficients in {0,...,q-1}
+**************************************************/
+void polyvec_compress_avx2(uint8_t r[KYBER_POLYVECCOMPRESSEDBYTES],
+                           const polyvec *a)
+{
+  unsigned int i;
+  for(i=0;i<KYBER_K;i++)
+    pack_poly(&r[32*POLYVEC_COMPRESS_BITS*i], &a->vec[i],
+              POLYVEC_COMPRESS_BITS, 1);
+}
+
+/*************************************************
+* Name:        polyvec_decompress_avx2
+*
+* Description: De-serialize and decompress vector of polynomials; same
+*              output as polyvec_decompress
+*
+* Arguments:   - polyvec *r:       pointer to output vector of polynomials
+*              - const uint8_t *a: pointer to input byte array
+*                                  (of length KYBER_POLYVECCOMPRESSEDBYTES)
+**************************************************/
+void polyvec_decompress_avx2(polyvec *r,
+                             const uint8_t a[KYBER_POLYVECCOMPRESSEDBYTES])
+{
+  unsigned int i;
+  for(i=0;i<KYBER_K;i++)
+    unpack_poly(&r->vec[i], &a[32*POLYVEC_COMPRESS_BITS*i],
+                POLYVEC_COMPRESS_BITS, 1);
+}
+
+#endif
@@ -5,6 +5,14 @@
 #include "reduce.h"
 #include "cbd.h"
 #include "symmetric.h"
+#ifdef KYBER_USE_AVX2
+#include <immintrin.h>
+#include "pack_avx2.h"
+#include "reduce_avx2.h"
+#endif
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+#include "fips202x4.h"
+#endif
 
 /*************************************************
 * Name:        poly_compress
@@ -17,12 +25,13 @@
 **************************************************/
 void poly_compress(uint8_t r[KYBER_POLYCOMPRESSEDBYTES], poly *a)
 {
-  unsigned int i,j;
-  uint8_t t[8];
-
   poly_csubq(a);
 
-#if (KYBER_POLYCOMPRESSEDBYTES == 128)
+#ifdef KYBER_USE_AVX2
+  poly_compress_avx2(r, a);
+#elif (KYBER_POLYCOMPRESSEDBYTES == 128)
+  unsigned int i,j;
+  uint8_t t[8];
   for(i=0;i<KYBER_N/8;i++) {
     for(j=0;j<8;j++)
       t[j] = ((((uint16_t)a->coeffs[8*i+j] << 4) + KYBER_Q/2)/KYBER_Q) & 15;
@@ -34,6 +43,8 @@ void poly_compress(uint8_t r[KYBER_POLYCOMPRESSEDBYTES], poly *a)
     r += 4;
   }
 #elif (KYBER_POLYCOMPRESSEDBYTES == 160)
+  unsigned int i,j;
+  uint8_t t[8];
   for(i=0;i<KYBER_N/8;i++) {
     for(j=0;j<8;j++)
       t[j] = ((((uint32_t)a->coeffs[8*i+j] << 5) + KYBER_Q/2)/KYBER_Q) & 31;
@@ -62,16 +73,17 @@ void poly_compress(uint8_t r[KYBER_POLYCOMPRESSEDBYTES], poly *a)
 **************************************************/
 void poly_decompress(poly *r, const uint8_t a[KYBER_POLYCOMPRESSEDBYTES])
 {
+#ifdef KYBER_USE_AVX2
+  poly_decompress_avx2(r, a);
+#elif (KYBER_POLYCOMPRESSEDBYTES == 128)
   unsigned int i;
-
-#if (KYBER_POLYCOMPRESSEDBYTES == 128)
   for(i=0;i<KYBER_N/2;i++) {
     r->coeffs[2*i+0] = (((uint16_t)(a[0] & 15)*KYBER_Q) + 8) >> 4;
     r->coeffs[2*i+1] = (((uint16_t)(a[0] >> 4)*KYBER_Q) + 8) >> 4;
     a += 1;
   }
 #elif (KYBER_POLYCOMPRESSEDBYTES == 160)
-  unsigned int j;
+  unsigned int i,j;
   uint8_t t[8];
   for(i=0;i<KYBER_N/8;i++) {
     t[0] = (a[0] >> 0);
@@ -103,11 +115,13 @@ void poly_decompress(poly *r, const uint8_t a[KYBER_POLYCOMPRESSEDBYTES])
 **************************************************/
 void poly_tobytes(uint8_t r[KYBER_POLYBYTES], poly *a)
 {
-  unsigned int i;
-  uint16_t t0, t1;
-
   poly_csubq(a);
 
+#ifdef KYBER_USE_AVX2
+  poly_tobytes_avx2(r, a);
+#else
+  unsigned int i;
+  uint16_t t0, t1;
   for(i=0;i<KYBER_N/2;i++) {
     t0 = a->coeffs[2*i];
     t1 = a->coeffs[2*i+1];
@@ -115,6 +129,7 @@ void poly_tobytes(uint8_t r[KYBER_POLYBYTES], poly *a)
     r[3*i+1] = (t0 >> 8) | (t1 << 4);
     r[3*i+2] = (t1 >> 4);
   }
+#endif
 }
 
 /*************************************************
@@ -129,11 +144,15 @@ void poly_tobytes(uint8_t r[KYBER_POLYBYTES], poly *a)
 **************************************************/
 void poly_frombytes(poly *r, const uint8_t a[KYBER_POLYBYTES])
 {
+#ifdef KYBER_USE_AVX2
+  poly_frombytes_avx2(r, a);
+#else
   unsigned int i;
   for(i=0;i<KYBER_N/2;i++) {
     r->coeffs[2*i]   = ((a[3*i+0] >> 0) | ((uint16_t)a[3*i+1] << 8)) & 0xFFF;
     r->coeffs[2*i+1] = ((a[3*i+1] >> 4) | ((uint16_t)a[3*i+2] << 4)) & 0xFFF;
   }
+#endif
 }
 
 /*************************************************
@@ -201,7 +220,11 @@ void poly_getnoise_eta1(poly *r, const uint8_t seed[KYBER_SYMBYTES], uint8_t non
 {
   uint8_t buf[KYBER_ETA1*KYBER_N/4];
   prf(buf, sizeof(buf), seed, nonce);
+#ifdef KYBER_USE_AVX2
+  cbd_eta1_avx2(r, buf);
+#else
   cbd_eta1(r, buf);
+#endif
 }
 
 /*************************************************
@@ -220,7 +243,116 @@ void poly_getnoise_eta2(poly *r, const uint8_t seed[KYBER_SYMBYTES], uint8_t non
 {
   uint8_t buf[KYBER_ETA2*KYBER_N/4];
   prf(buf, sizeof(buf), seed, nonce);
+#ifdef KYBER_USE_AVX2
+  cbd_eta2_avx2(r, buf);
+#else
   cbd_eta2(r, buf);
+#endif
+}
+
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+#define NOISE_X4_NBLOCKS ((KYBER_ETA1*KYBER_N/4 + SHAKE256_RATE - 1)/SHAKE256_RATE)
+
+/*************************************************
+* Name:        prf_x4
+*
+* Description: Four instances of the SHAKE256 PRF with common key and
+*              individual nonces, computed with 4-way parallel Keccak.
+*              Every output is a prefix-compatible extension of
+*              prf(out, len, seed, nonce), long enough for KYBER_ETA1.
+*
+* Arguments:   - uint8_t buf[4][]:    pointer to output byte arrays
+*              - const uint8_t *seed: pointer to input seed
+*                                     (of length KYBER_SYMBYTES bytes)
+*              - const uint8_t *nonce: four one-byte input nonces
+**************************************************/
+static void prf_x4(uint8_t buf[4][NOISE_X4_NBLOCKS*SHAKE256_RATE],
+                   const uint8_t seed[KYBER_SYMBYTES],
+                   const uint8_t nonce[4])
+{
+  unsigned int i, j;
+  uint8_t extkey[4][KYBER_SYMBYTES+1];
+  keccakx4_state state;
+
+  for(j=0;j<4;j++) {
+    for(i=0;i<KYBER_SYMBYTES;i++)
+      extkey[j][i] = seed[i];
+    extkey[j][KYBER_SYMBYTES] = nonce[j];
+  }
+
+  shake256x4_absorb(&state, extkey[0], extkey[1], extkey[2], extkey[3], KYBER_SYMBYTES+1);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], NOISE_X4_NBLOCKS, &state);
+}
+#endif
+
+/*************************************************
+* Name:        poly_getnoise_eta1_4x
+*
+* Description: Sample four polynomials as poly_getnoise_eta1 would, with
+*              the four PRF calls computed in parallel where supported.
+*              Outputs may be NULL to leave a lane unused.
+*
+* Arguments:   - poly *r0,...,*r3:    pointers to output polynomials (or NULL)
+*              - const uint8_t *seed: pointer to input seed
+*                                     (of length KYBER_SYMBYTES bytes)
+*              - uint8_t nonce0,...,nonce3: one-byte input nonces
+**************************************************/
+void poly_getnoise_eta1_4x(poly *r0, poly *r1, poly *r2, poly *r3,
+                           const uint8_t seed[KYBER_SYMBYTES],
+                           uint8_t nonce0, uint8_t nonce1,
+                           uint8_t nonce2, uint8_t nonce3)
+{
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+  unsigned int j;
+  uint8_t buf[4][NOISE_X4_NBLOCKS*SHAKE256_RATE];
+  const uint8_t nonce[4] = {nonce0, nonce1, nonce2, nonce3};
+  poly *r[4] = {r0, r1, r2, r3};
+
+  prf_x4(buf, seed, nonce);
+  for(j=0;j<4;j++)
+    if(r[j])
+      cbd_eta1_avx2(r[j], buf[j]);
+#else
+  if(r0) poly_getnoise_eta1(r0, seed, nonce0);
+  if(r1) poly_getnoise_eta1(r1, seed, nonce1);
+  if(r2) poly_getnoise_eta1(r2, seed, nonce2);
+  if(r3) poly_getnoise_eta1(r3, seed, nonce3);
+#endif
+}
+
+/*************************************************
+* Name:        poly_getnoise_eta2_4x
+*
+* Description: Sample four polynomials as poly_getnoise_eta2 would, with
+*              the four PRF calls computed in parallel where supported.
+*              Outputs may be NULL to leave a lane unused.
+*
+* Arguments:   - poly *r0,...,*r3:    pointers to output polynomials (or NULL)
+*              - const uint8_t *seed: pointer to input seed
+*                                     (of length KYBER_SYMBYTES bytes)
+*              - uint8_t nonce0,...,nonce3: one-byte input nonces
+**************************************************/
+void poly_getnoise_eta2_4x(poly *r0, poly *r1, poly *r2, poly *r3,
+                           const uint8_t seed[KYBER_SYMBYTES],
+                           uint8_t nonce0, uint8_t nonce1,
+                           uint8_t nonce2, uint8_t nonce3)
+{
+#if defined(KYBER_USE_AVX2) && !defined(KYBER_90S)
+  unsigned int j;
+  uint8_t buf[4][NOISE_X4_NBLOCKS*SHAKE256_RATE];
+  const uint8_t nonce[4] = {nonce0, nonce1, nonce2, nonce3};
+  poly *r[4] = {r0, r1, r2, r3};
+
+  prf_x4(buf, seed, nonce);
+  for(j=0;j<4;j++)
+    if(r[j])
+      cbd_eta2_avx2(r[j], buf[j]);
+#else
+  if(r0) poly_getnoise_eta2(r0, seed, nonce0);
+  if(r1) poly_getnoise_eta2(r1, seed, nonce1);
+  if(r2) poly_getnoise_eta2(r2, seed, nonce2);
+  if(r3) poly_getnoise_eta2(r3, seed, nonce3);
+#endif
 }
 
 
@@ -235,7 +367,11 @@ void poly_getnoise_eta2(poly *r, const uint8_t seed[KYBER_SYMBYTES], uint8_t non
 **************************************************/
 void poly_ntt(poly *r)
 {
+#ifdef KYBER_USE_AVX2
+  ntt_avx2(r->coeffs);
+#else
   ntt(r->coeffs);
+#endif
   poly_reduce(r);
 }
 
@@ -250,7 +386,11 @@ void poly_ntt(poly *r)
 **************************************************/
 void poly_invntt_tomont(poly *r)
 {
+#ifdef KYBER_USE_AVX2
+  invntt_avx2(r->coeffs);
+#else
   invntt(r->coeffs);
+#endif
 }
 
 /*************************************************
@@ -264,12 +404,16 @@ void poly_invntt_tomont(poly *r)
 **************************************************/
 void poly_basemul_montgomery(poly *r, const poly *a, const poly *b)
 {
+#ifdef KYBER_USE_AVX2
+  basemul_avx2(r->coeffs, a->coeffs, b->coeffs);
+#else
   unsigned int i;
   for(i=0;i<KYBER_N/4;i++) {
     basemul(&r->coeffs[4*i], &a->coeffs[4*i], &b->coeffs[4*i], zetas[64+i]);
     basemul(&r->coeffs[4*i+2], &a->coeffs[4*i+2], &b->coeffs[4*i+2],
             -zetas[64+i]);
   }
+#endif
 }
 
 /*************************************************
@@ -315,8 +459,17 @@ void poly_reduce(poly *r)
 void poly_csubq(poly *r)
 {
   unsigned int i;
+#ifdef KYBER_USE_AVX2
+  __m256i f;
+  for(i=0;i<KYBER_N/16;i++) {
+    f = _mm256_loadu_si256((const __m256i *)&r->coeffs[16*i]);
+    f = csubq_avx2(f);
+    _mm256_storeu_si256((__m256i *)&r->coeffs[16*i], f);
+  }
+#else
   for(i=0;i<KYBER_N;i++)
     r->coeffs[i] = csubq(r->coeffs[i]);
+#endif
 }
 
 /*************************************************
@@ -2,6 +2,9 @@
 #include "params.h"
 #include "poly.h"
 #include "polyvec.h"
+#ifdef KYBER_USE_AVX2
+#include "pack_avx2.h"
+#endif
 
 /*************************************************
 * Name:        polyvec_compress
@@ -14,11 +17,12 @@
 **************************************************/
 void polyvec_compress(uint8_t r[KYBER_POLYVECCOMPRESSEDBYTES], polyvec *a)
 {
-  unsigned int i,j,k;
-
   polyvec_csubq(a);
 
-#if (KYBER_POLYVECCOMPRESSEDBYTES == (KYBER_K * 352))
+#ifdef KYBER_USE_AVX2
+  polyvec_compress_avx2(r, a);
+#elif (KYBER_POLYVECCOMPRESSEDBYTES == (KYBER_K * 352))
+  unsigned int i,j,k;
   uint16_t t[8];
   for(i=0;i<KYBER_K;i++) {
     for(j=0;j<KYBER_N/8;j++) {
@@ -41,6 +45,7 @@ void polyvec_compress(uint8_t r[KYBER_POLYVECCOMPRESSEDBYTES], polyvec *a)
     }
   }
 #elif (KYBER_POLYVECCOMPRESSEDBYTES == (KYBER_K * 320))
+  unsigned int i,j,k;
   uint16_t t[4];
   for(i=0;i<KYBER_K;i++) {
     for(j=0;j<KYBER_N/4;j++) {
@@ -74,9 +79,10 @@ void polyvec_compress(uint8_t r[KYBER_POLYVECCOMPRESSEDBYTES], polyvec *a)
 void polyvec_decompress(polyvec *r,
                         const uint8_t a[KYBER_POLYVECCOMPRESSEDBYTES])
 {
+#ifdef KYBER_USE_AVX2
+  polyvec_decompress_avx2(r, a);
+#elif (KYBER_POLYVECCOMPRESSEDBYTES == (KYBER_K * 352))
   unsigned int i,j,k;
-
-#if (KYBER_POLYVECCOMPRESSEDBYTES == (KYBER_K * 352))
   uint16_t t[8];
   for(i=0;i<KYBER_K;i++) {
     for(j=0;j<KYBER_N/8;j++) {
@@ -95,6 +101,7 @@ void polyvec_decompress(polyvec *r,
     }
   }
 #elif (KYBER_POLYVECCOMPRESSEDBYTES == (KYBER_K * 320))
+  unsigned int i,j,k;
   uint16_t t[4];
   for(i=0;i<KYBER_K;i++) {
     for(j=0;j<KYBER_N/4;j++) {
@@ -0,0 +1,14 @@
+#ifndef REJSAMPLE_AVX2_H
+#define REJSAMPLE_AVX2_H
+
+#include <stdint.h>
+#include "params.h"
+
+#define rej_uniform_avx2 KYBER_NAMESPACE(_rej_uniform_avx2)
+unsigned int rej_uniform_avx2(int16_t *r,
+                              unsigned int len,
+                              const uint8_t *buf,
+                              unsigned int buflen,
+                              unsigned int *pos);
+
+#endif
@@ -6,12 +6,15 @@
 //
 
 #include <string.h>
+#include <pthread.h>
 #include "rng.h"
 #include <openssl/conf.h>
 #include <openssl/evp.h>
 #include <openssl/err.h>
 
 AES256_CTR_DRBG_struct  DRBG_ctx;
+// randombytes() may be called from several threads (e.g. the keypair pool worker)
+static pthread_mutex_t  DRBG_lock = PTHREAD_MUTEX_INITIALIZER;
 
 void    AES256_ECB(unsigned char *key, unsigned char *ctr, unsigned char *buffer);
 
@@ -142,6 +145,7 @@ randombytes_init(unsigned char *entropy_input,
 {
     unsigned char   seed_material[48];
 
+    pthread_mutex_lock(&DRBG_lock);
     memcpy(seed_material, entropy_input, 48);
     if (personalization_string)
         for (int i=0; i<48; i++)
@@ -150,6 +154,7 @@ randombytes_init(unsigned char *entropy_input,
     memset(DRBG_ctx.V, 0x00, 16);
     AES256_CTR_DRBG_Update(seed_material, DRBG_ctx.Key, DRBG_ctx.V);
     DRBG_ctx.reseed_counter = 1;
+    pthread_mutex_unlock(&DRBG_lock);
 }
 
 int
@@ -158,6 +163,7 @@ randombytes(unsigned char *x, unsigned long long xlen)
     unsigned char   block[16];
     int             i = 0;
 
+    pthread_mutex_lock(&DRBG_lock);
     while ( xlen > 0 ) {
         //increment V
         for (int j=15; j>=0; j--) {
@@ -181,6 +187,7 @@ randombytes(unsigned char *x, unsigned long long xlen)
     }
     AES256_CTR_DRBG_Update(NULL, DRBG_ctx.Key, DRBG_ctx.V);
     DRBG_ctx.reseed_counter++;
+    pthread_mutex_unlock(&DRBG_lock);
 
     return RNG_SUCCESS;
 }
@@ -8,6 +8,8 @@
 
 #define AES256CTR_NAMESPACE(s) pqcrystals_aes256ctr_ref##s
 
+/* sk_exp holds the bitsliced key schedule, or the AES-NI round keys when
+ * the CPU supports them; a state must stay on the CPU it was set up on */
 typedef struct {
   uint64_t sk_exp[120];
   uint32_t ivw[16];
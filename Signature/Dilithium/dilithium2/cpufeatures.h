@@ -0,0 +1,17 @@
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+#include "config.h"
+
+#ifdef DILITHIUM_USE_AVX2
+/* AVX2 functions are compiled for AVX2 independently of the global
+ * compiler flags and must only be called after cpu_has_avx2() */
+#define AVX2_TARGET __attribute__((target("avx2")))
+#define cpu_has_avx2() __builtin_cpu_supports("avx2")
+/* Alignment of polynomials read with 256-bit loads */
+#define VECTOR_ALIGN __attribute__((aligned(32)))
+#else
+#define VECTOR_ALIGN
+#endif
+
+#endif
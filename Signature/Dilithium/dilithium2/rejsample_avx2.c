@@ -0,0 +1,336 @@
+#include <immintrin.h>
+#include <stdint.h>
+#include "params.h"
+#include "cpufeatures.h"
+#include "rejsample_avx2.h"
+
+#ifdef DILITHIUM_USE_AVX2
+
+/*
+ * rej_idx[m] lists the 32-bit lanes whose bit is set in the 8-bit mask m,
+ * in increasing order, padded with zeros. Generated by
+
+  for(m = 0; m < 256; ++m)
+    for(i = 0, j = 0; i < 8; ++i)
+      if(m >> i & 1)
+        rej_idx[m][j++] = i;
+
+ */
+static const uint8_t rej_idx[256][8] __attribute__((aligned(8))) = {
+  {0, 0, 0, 0, 0, 0, 0, 0},
+  {0, 0, 0, 0, 0, 0, 0, 0},
+  {1, 0, 0, 0, 0, 0, 0, 0},
+  {0, 1, 0, 0, 0, 0, 0, 0},
+  {2, 0, 0, 0, 0, 0, 0, 0},
+  {0, 2, 0, 0, 0, 0, 0, 0},
+  {1, 2, 0, 0, 0, 0, 0, 0},
+  {0, 1, 2, 0, 0, 0, 0, 0},
+  {3, 0, 0, 0, 0, 0, 0, 0},
+  {0, 3, 0, 0, 0, 0, 0, 0},
+  {1, 3, 0, 0, 0, 0, 0, 0},
+  {0, 1, 3, 0, 0, 0, 0, 0},
+  {2, 3, 0, 0, 0, 0, 0, 0},
+  {0, 2, 3, 0, 0, 0, 0, 0},
+  {1, 2, 3, 0, 0, 0, 0, 0},
+  {0, 1, 2, 3, 0, 0, 0, 0},
+  {4, 0, 0, 0, 0, 0, 0, 0},
+  {0, 4, 0, 0, 0, 0, 0, 0},
+  {1, 4, 0, 0, 0, 0, 0, 0},
+  {0, 1, 4, 0, 0, 0, 0, 0},
+  {2, 4, 0, 0, 0, 0, 0, 0},
+  {0, 2, 4, 0, 0, 0, 0, 0},
+  {1, 2, 4, 0, 0, 0, 0, 0},
+  {0, 1, 2, 4, 0, 0, 0, 0},
+  {3, 4, 0, 0, 0, 0, 0, 0},
+  {0, 3, 4, 0, 0, 0, 0, 0},
+  {1, 3, 4, 0, 0, 0, 0, 0},
+  {0, 1, 3, 4, 0, 0, 0, 0},
+  {2, 3, 4, 0, 0, 0, 0, 0},
+  {0, 2, 3, 4, 0, 0, 0, 0},
+  {1, 2, 3, 4, 0, 0, 0, 0},
+  {0, 1, 2, 3, 4, 0, 0, 0},
+  {5, 0, 0, 0, 0, 0, 0, 0},
+  {0, 5, 0, 0, 0, 0, 0, 0},
+  {1, 5, 0, 0, 0, 0, 0, 0},
+  {0, 1, 5, 0, 0, 0, 0, 0},
+  {2, 5, 0, 0, 0, 0, 0, 0},
+  {0, 2, 5, 0, 0, 0, 0, 0},
+  {1, 2, 5, 0, 0, 0, 0, 0},
+  {0, 1, 2, 5, 0, 0, 0, 0},
+  {3, 5, 0, 0, 0, 0, 0, 0},
+  {0, 3, 5, 0, 0, 0, 0, 0},
+  {1, 3, 5, 0, 0, 0, 0, 0},
+  {0, 1, 3, 5, 0, 0, 0, 0},
+  {2, 3, 5, 0, 0, 0, 0, 0},
+  {0, 2, 3, 5, 0, 0, 0, 0},
+  {1, 2, 3, 5, 0, 0, 0, 0},
+  {0, 1, 2, 3, 5, 0, 0, 0},
+  {4, 5, 0, 0, 0, 0, 0, 0},
+  {0, 4, 5, 0, 0, 0, 0, 0},
+  {1, 4, 5, 0, 0, 0, 0, 0},
+  {0, 1, 4, 5, 0, 0, 0, 0},
+  {2, 4, 5, 0, 0, 0, 0, 0},
+  {0, 2, 4, 5, 0, 0, 0, 0},
+  {1, 2, 4, 5, 0, 0, 0, 0},
+  {0, 1, 2, 4, 5, 0, 0, 0},
+  {3, 4, 5, 0, 0, 0, 0, 0},
+  {0, 3, 4, 5, 0, 0, 0, 0},
+  {1, 3, 4, 5, 0, 0, 0, 0},
+  {0, 1, 3, 4, 5, 0, 0, 0},
+  {2, 3, 4, 5, 0, 0, 0, 0},
+  {0, 2, 3, 4, 5, 0, 0, 0},
+  {1, 2, 3, 4, 5, 0, 0, 0},
+  {0, 1, 2, 3, 4, 5, 0, 0},
+  {6, 0, 0, 0, 0, 0, 0, 0},
+  {0, 6, 0, 0, 0, 0, 0, 0},
+  {1, 6, 0, 0, 0, 0, 0, 0},
+  {0, 1, 6, 0, 0, 0, 0, 0},
+  {2, 6, 0, 0, 0, 0, 0, 0},
+  {0, 2, 6, 0, 0, 0, 0, 0},
+  {1, 2, 6, 0, 0, 0, 0, 0},
+  {0, 1, 2, 6, 0, 0, 0, 0},
+  {3, 6, 0, 0, 0, 0, 0, 0},
+  {0, 3, 6, 0, 0, 0, 0, 0},
+  {1, 3, 6, 0, 0, 0, 0, 0},
+  {0, 1, 3, 6, 0, 0, 0, 0},
+  {2, 3, 6, 0, 0, 0, 0, 0},
+  {0, 2, 3, 6, 0, 0, 0, 0},
+  {1, 2, 3, 6, 0, 0, 0, 0},
+  {0, 1, 2, 3, 6, 0, 0, 0},
+  {4, 6, 0, 0, 0, 0, 0, 0},
+  {0, 4, 6, 0, 0, 0, 0, 0},
+  {1, 4, 6, 0, 0, 0, 0, 0},
+  {0, 1, 4, 6, 0, 0, 0, 0},
+  {2, 4, 6, 0, 0, 0, 0, 0},
+  {0, 2, 4, 6, 0, 0, 0, 0},
+  {1, 2, 4, 6, 0, 0, 0, 0},
+  {0, 1, 2, 4, 6, 0, 0, 0},
+  {3, 4, 6, 0, 0, 0, 0, 0},
+  {0, 3, 4, 6, 0, 0, 0, 0},
+  {1, 3, 4, 6, 0, 0, 0, 0},
+  {0, 1, 3, 4, 6, 0, 0, 0},
+  {2, 3, 4, 6, 0, 0, 0, 0},
+  {0, 2, 3, 4, 6, 0, 0, 0},
+  {1, 2, 3, 4, 6, 0, 0, 0},
+  {0, 1, 2, 3, 4, 6, 0, 0},
+  {5, 6, 0, 0, 0, 0, 0, 0},
+  {0, 5, 6, 0, 0, 0, 0, 0},
+  {1, 5, 6, 0, 0, 0, 0, 0},
+  {0, 1, 5, 6, 0, 0, 0, 0},
+  {2, 5, 6, 0, 0, 0, 0, 0},
+  {0, 2, 5, 6, 0, 0, 0, 0},
+  {1, 2, 5, 6, 0, 0, 0, 0},
+  {0, 1, 2, 5, 6, 0, 0, 0},
+  {3, 5, 6, 0, 0, 0, 0, 0},
+  {0, 3, 5, 6, 0, 0, 0, 0},
+  {1, 3, 5, 6, 0, 0, 0, 0},
+  {0, 1, 3, 5, 6, 0, 0, 0},
+  {2, 3, 5, 6, 0, 0, 0, 0},
+  {0, 2, 3, 5, 6, 0, 0, 0},
+  {1, 2, 3, 5, 6, 0, 0, 0},
+  {0, 1, 2, 3, 5, 6, 0, 0},
+  {4, 5, 6, 0, 0, 0, 0, 0},
+  {0, 4, 5, 6, 0, 0, 0, 0},
+  {1, 4, 5, 6, 0, 0, 0, 0},
+  {0, 1, 4, 5, 6, 0, 0, 0},
+  {2, 4, 5, 6, 0, 0, 0, 0},
+  {0, 2, 4, 5, 6, 0, 0, 0},
+  {1, 2, 4, 5, 6, 0, 0, 0},
+  {0, 1, 2, 4, 5, 6, 0, 0},
+  {3, 4, 5, 6, 0, 0, 0, 0},
+  {0, 3, 4, 5, 6, 0, 0, 0},
+  {1, 3, 4, 5, 6, 0, 0, 0},
+  {0, 1, 3, 4, 5, 6, 0, 0},
+  {2, 3, 4, 5, 6, 0, 0, 0},
+  {0, 2, 3, 4, 5, 6, 0, 0},
+  {1, 2, 3, 4, 5, 6, 0, 0},
+  {0, 1, 2, 3, 4, 5, 6, 0},
+  {7, 0, 0, 0, 0, 0, 0, 0},
+  {0, 7, 0, 0, 0, 0, 0, 0},
+  {1, 7, 0, 0, 0, 0, 0, 0},
+  {0, 1, 7, 0, 0, 0, 0, 0},
+  {2, 7, 0, 0, 0, 0, 0, 0},
+  {0, 2, 7, 0, 0, 0, 0, 0},
+  {1, 2, 7, 0, 0, 0, 0, 0},
+  {0, 1, 2, 7, 0, 0, 0, 0},
+  {3, 7, 0, 0, 0, 0, 0, 0},
+  {0, 3, 7, 0, 0, 0, 0, 0},
+  {1, 3, 7, 0, 0, 0, 0, 0},
+  {0, 1, 3, 7, 0, 0, 0, 0},
+  {2, 3, 7, 0, 0, 0, 0, 0},
+  {0, 2, 3, 7, 0, 0, 0, 0},
+  {1, 2, 3, 7, 0, 0, 0, 0},
+  {0, 1, 2, 3, 7, 0, 0, 0},
+  {4, 7, 0, 0, 0, 0, 0, 0},
+  {0, 4, 7, 0, 0, 0, 0, 0},
+  {1, 4, 7, 0, 0, 0, 0, 0},
+  {0, 1, 4, 7, 0, 0, 0, 0},
+  {2, 4, 7, 0, 0, 0, 0, 0},
+  {0, 2, 4, 7, 0, 0, 0, 0},
+  {1, 2, 4, 7, 0, 0, 0, 0},
+  {0, 1, 2, 4, 7, 0, 0, 0},
+  {3, 4, 7, 0, 0, 0, 0, 0},
+  {0, 3, 4, 7, 0, 0, 0, 0},
+  {1, 3, 4, 7, 0, 0, 0, 0},
+  {0, 1, 3, 4, 7, 0, 0, 0},
+  {2, 3, 4, 7, 0, 0, 0, 0},
+  {0, 2, 3, 4, 7, 0, 0, 0},
+  {1, 2, 3, 4, 7, 0, 0, 0},
+  {0, 1, 2, 3, 4, 7, 0, 0},
+  {5, 7, 0, 0, 0, 0, 0, 0},
+  {0, 5, 7, 0, 0, 0, 0, 0},
+  {1, 5, 7, 0, 0, 0, 0, 0},
+  {0, 1, 5, 7, 0, 0, 0, 0},
+  {2, 5, 7, 0, 0, 0, 0, 0},
+  {0, 2, 5, 7, 0, 0, 0, 0},
+  {1, 2, 5, 7, 0, 0, 0, 0},
+  {0, 1, 2, 5, 7, 0, 0, 0},
+  {3, 5, 7, 0, 0, 0, 0, 0},
+  {0, 3, 5, 7, 0, 0, 0, 0},
+  {1, 3, 5, 7, 0, 0, 0, 0},
+  {0, 1, 3, 5, 7, 0, 0, 0},
+  {2, 3, 5, 7, 0, 0, 0, 0},
+  {0, 2, 3, 5, 7, 0, 0, 0},
+  {1, 2, 3, 5, 7, 0, 0, 0},
+  {0, 1, 2, 3, 5, 7, 0, 0},
+  {4, 5, 7, 0, 0, 0, 0, 0},
+  {0, 4, 5, 7, 0, 0, 0, 0},
+  {1, 4, 5, 7, 0, 0, 0, 0},
+  {0, 1, 4, 5, 7, 0, 0, 0},
+  {2, 4, 5, 7, 0, 0, 0, 0},
+  {0, 2, 4, 5, 7, 0, 0, 0},
+  {1, 2, 4, 5, 7, 0, 0, 0},
+  {0, 1, 2, 4, 5, 7, 0, 0},
+  {3, 4, 5, 7, 0, 0, 0, 0},
+  {0, 3, 4, 5, 7, 0, 0, 0},
+  {1, 3, 4, 5, 7, 0, 0, 0},
+  {0, 1, 3, 4, 5, 7, 0, 0},
+  {2, 3, 4, 5, 7, 0, 0, 0},
+  {0, 2, 3, 4, 5, 7, 0, 0},
+  {1, 2, 3, 4, 5, 7, 0, 0},
+  {0, 1, 2, 3, 4, 5, 7, 0},
+  {6, 7, 0, 0, 0, 0, 0, 0},
+  {0, 6, 7, 0, 0, 0, 0, 0},
+  {1, 6, 7, 0, 0, 0, 0, 0},
+  {0, 1, 6, 7, 0, 0, 0, 0},
+  {2, 6, 7, 0, 0, 0, 0, 0},
+  {0, 2, 6, 7, 0, 0, 0, 0},
+  {1, 2, 6, 7, 0, 0, 0, 0},
+  {0, 1, 2, 6, 7, 0, 0, 0},
+  {3, 6, 7, 0, 0, 0, 0, 0},
+  {0, 3, 6, 7, 0, 0, 0, 0},
+  {1, 3, 6, 7, 0, 0, 0, 0},
+  {0, 1, 3, 6, 7, 0, 0, 0},
+  {2, 3, 6, 7, 0, 0, 0, 0},
+  {0, 2, 3, 6, 7, 0, 0, 0},
+  {1, 2, 3, 6, 7, 0, 0, 0},
+  {0, 1, 2, 3, 6, 7, 0, 0},
+  {4, 6, 7, 0, 0, 0, 0, 0},
+  {0, 4, 6, 7, 0, 0, 0, 0},
+  {1, 4, 6, 7, 0, 0, 0, 0},
+  {0, 1, 4, 6, 7, 0, 0, 0},
+  {2, 4, 6, 7, 0, 0, 0, 0},
+  {0, 2, 4, 6, 7, 0, 0, 0},
+  {1, 2, 4, 6, 7, 0, 0, 0},
+  {0, 1, 2, 4, 6, 7, 0, 0},
+  {3, 4, 6, 7, 0, 0, 0, 0},
+  {0, 3, 4, 6, 7, 0, 0, 0},
+  {1, 3, 4, 6, 7, 0, 0, 0},
+  {0, 1, 3, 4, 6, 7, 0, 0},
+  {2, 3, 4, 6, 7, 0, 0, 0},
+  {0, 2, 3, 4, 6, 7, 0, 0},
+  {1, 2, 3, 4, 6, 7, 0, 0},
+  {0, 1, 2, 3, 4, 6, 7, 0},
+  {5, 6, 7, 0, 0, 0, 0, 0},
+  {0, 5, 6, 7, 0, 0, 0, 0},
+  {1, 5, 6, 7, 0, 0, 0, 0},
+  {0, 1, 5, 6, 7, 0, 0, 0},
+  {2, 5, 6, 7, 0, 0, 0, 0},
+  {0, 2, 5, 6, 7, 0, 0, 0},
+  {1, 2, 5, 6, 7, 0, 0, 0},
+  {0, 1, 2, 5, 6, 7, 0, 0},
+  {3, 5, 6, 7, 0, 0, 0, 0},
+  {0, 3, 5, 6, 7, 0, 0, 0},
+  {1, 3, 5, 6, 7, 0, 0, 0},
+  {0, 1, 3, 5, 6, 7, 0, 0},
+  {2, 3, 5, 6, 7, 0, 0, 0},
+  {0, 2, 3, 5, 6, 7, 0, 0},
+  {1, 2, 3, 5, 6, 7, 0, 0},
+  {0, 1, 2, 3, 5, 6, 7, 0},
+  {4, 5, 6, 7, 0, 0, 0, 0},
+  {0, 4, 5, 6, 7, 0, 0, 0},
+  {1, 4, 5, 6, 7, 0, 0, 0},
+  {0, 1, 4, 5, 6, 7, 0, 0},
+  {2, 4, 5, 6, 7, 0, 0, 0},
+  {0, 2, 4, 5, 6, 7, 0, 0},
+  {1, 2, 4, 5, 6, 7, 0, 0},
+  {0, 1, 2, 4, 5, 6, 7, 0},
+  {3, 4, 5, 6, 7, 0, 0, 0},
+  {0, 3, 4, 5, 6, 7, 0, 0},
+  {1, 3, 4, 5, 6, 7, 0, 0},
+  {0, 1, 3, 4, 5, 6, 7, 0},
+  {2, 3, 4, 5, 6, 7, 0, 0},
+  {0, 2, 3, 4, 5, 6, 7, 0},
+  {1, 2, 3, 4, 5, 6, 7, 0},
+  {0, 1, 2, 3, 4, 5, 6, 7}
+};
+
+/*************************************************
+* Name:        rej_uniform_avx2
+*
+* Description: Vectorized front end of rej_uniform. Processes 8 candidate
+*              23-bit values (24 bytes of buf) per iteration and compacts
+*              the accepted ones with a permutation from rej_idx, keeping
+*              their order. Stops while at least 8 outputs are still missing
+*              and 32 input bytes are left, so the caller finishes with the
+*              scalar loop and the overall output is unchanged.
+*              Only call if cpu_has_avx2().
+*
+* Arguments:   - int32_t *a: pointer to output array (allocated)
+*              - unsigned int len: number of coefficients to be sampled
+*              - const uint8_t *buf: array of random bytes
+*              - unsigned int buflen: length of array of random bytes
+*              - unsigned int *pos: pointer to output number of consumed
+*                                   bytes of buf
+*
+* Returns number of sampled coefficients.
+**************************************************/
+AVX2_TARGET
+unsigned int rej_uniform_avx2(int32_t *a,
+                              unsigned int len,
+                              const uint8_t *buf,
+                              unsigned int buflen,
+                              unsigned int *pos)
+{
+  unsigned int ctr, p, good;
+  __m256i d, tmp;
+  const __m256i bound = _mm256_set1_epi32(Q);
+  const __m256i mask = _mm256_set1_epi32(0x7FFFFF);
+  const __m256i shuf = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1,
+                                        6, 7, 8, -1, 9, 10, 11, -1,
+                                        4, 5, 6, -1, 7, 8, 9, -1,
+                                        10, 11, 12, -1, 13, 14, 15, -1);
+
+  ctr = p = 0;
+  while(ctr + 8 <= len && p + 32 <= buflen) {
+    /* bytes 0..15 to the low and 8..23 to the high 128-bit lane */
+    d = _mm256_loadu_si256((__m256i *)&buf[p]);
+    d = _mm256_permute4x64_epi64(d, 0x94);
+    d = _mm256_shuffle_epi8(d, shuf);
+    d = _mm256_and_si256(d, mask);
+    p += 24;
+
+    tmp = _mm256_cmpgt_epi32(bound, d);
+    good = _mm256_movemask_ps(_mm256_castsi256_ps(tmp));
+    tmp = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i *)&rej_idx[good]));
+    d = _mm256_permutevar8x32_epi32(d, tmp);
+
+    _mm256_storeu_si256((__m256i *)&a[ctr], d);
+    ctr += __builtin_popcount(good);
+  }
+
+  *pos = p;
+  return ctr;
+}
+
+#endif
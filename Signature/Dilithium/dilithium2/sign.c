@@ -83,28 +83,73 @@ int crypto_sign_signature(uint8_t *sig,
                           size_t mlen,
                           const uint8_t *sk)
 {
-  unsigned int n;
-  uint8_t seedbuf[2*SEEDBYTES + 3*CRHBYTES];
-  uint8_t *rho, *tr, *key, *mu, *rhoprime;
+  crypto_sign_ctx ctx;
+
+  crypto_sign_ctx_init(&ctx, sk);
+  return crypto_sign_signature_ctx(&ctx, sig, siglen, m, mlen);
+}
+
+/*************************************************
+* Name:        crypto_sign_ctx_init
+*
+* Description: Prepares a secret key for repeated signing: unpacks it,
+*              expands the matrix A from rho and transforms s1, s2 and t0
+*              to NTT domain.
+*
+* Arguments:   - crypto_sign_ctx *ctx: pointer to output signing context
+*              - const uint8_t *sk:    pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_ctx_init(crypto_sign_ctx *ctx, const uint8_t *sk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_sk(rho, ctx->tr, ctx->key, &ctx->t0, &ctx->s1, &ctx->s2, sk);
+
+  /* Expand matrix and transform vectors */
+  polyvec_matrix_expand(ctx->mat, rho);
+  polyvecl_ntt(&ctx->s1);
+  polyveck_ntt(&ctx->s2);
+  polyveck_ntt(&ctx->t0);
+  return 0;
+}
+
+/*************************************************
+* Name:        sign_mu
+*
+* Description: Computes signature from the message representative
+*              mu = CRH(tr, msg); shared by the one-shot and the
+*              streaming signing functions.
+*
+* Arguments:   - const crypto_sign_ctx *ctx: pointer to signing context
+*              - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - const uint8_t mu[]: message representative of length CRHBYTES
+*
+* Returns 0 (success)
+**************************************************/
+static int sign_mu(const crypto_sign_ctx *ctx,
+                   uint8_t *sig,
+                   size_t *siglen,
+                   const uint8_t mu[CRHBYTES])
+{
+  unsigned int i, n;
+  uint8_t seedbuf[SEEDBYTES + 2*CRHBYTES];
+  uint8_t *key, *rhoprime;
   uint16_t nonce = 0;
-  polyvecl mat[K], s1, y, z;
-  polyveck t0, s2, w1, w0, h;
+  polyvecl y, z;
+  polyveck w1, w0, h;
   poly cp;
   keccak_state state;
 
-  rho = seedbuf;
-  tr = rho + SEEDBYTES;
-  key = tr + CRHBYTES;
-  mu = key + SEEDBYTES;
-  rhoprime = mu + CRHBYTES;
-  unpack_sk(rho, tr, key, &t0, &s1, &s2, sk);
-
-  /* Compute CRH(tr, msg) */
-  shake256_init(&state);
-  shake256_absorb(&state, tr, CRHBYTES);
-  shake256_absorb(&state, m, mlen);
-  shake256_finalize(&state);
-  shake256_squeeze(mu, CRHBYTES, &state);
+  /* key and mu have to be adjacent for CRH(key, mu) */
+  key = seedbuf;
+  rhoprime = key + SEEDBYTES + CRHBYTES;
+  for(i = 0; i < SEEDBYTES; ++i)
+    key[i] = ctx->key[i];
+  for(i = 0; i < CRHBYTES; ++i)
+    key[SEEDBYTES + i] = mu[i];
 
 #ifdef DILITHIUM_RANDOMIZED_SIGNING
   randombytes(rhoprime, CRHBYTES);
@@ -112,12 +157,6 @@ int crypto_sign_signature(uint8_t *sig,
   crh(rhoprime, key, SEEDBYTES + CRHBYTES);
 #endif
 
-  /* Expand matrix and transform vectors */
-  polyvec_matrix_expand(mat, rho);
-  polyvecl_ntt(&s1);
-  polyveck_ntt(&s2);
-  polyveck_ntt(&t0);
-
 rej:
   /* Sample intermediate vector y */
   polyvecl_uniform_gamma1(&y, rhoprime, nonce++);
@@ -125,7 +164,7 @@ rej:
   polyvecl_ntt(&z);
 
   /* Matrix-vector multiplication */
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+  polyvec_matrix_pointwise_montgomery(&w1, ctx->mat, &z);
   polyveck_reduce(&w1);
   polyveck_invntt_tomont(&w1);
 
@@ -143,7 +182,7 @@ rej:
   poly_ntt(&cp);
 
   /* Compute z, reject if it reveals secret */
-  polyvecl_pointwise_poly_montgomery(&z, &cp, &s1);
+  polyvecl_pointwise_poly_montgomery(&z, &cp, &ctx->s1);
   polyvecl_invntt_tomont(&z);
   polyvecl_add(&z, &z, &y);
   polyvecl_reduce(&z);
@@ -152,7 +191,7 @@ rej:
 
   /* Check that subtracting cs2 does not change high bits of w and low bits
    * do not reveal secret information */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &s2);
+  polyveck_pointwise_poly_montgomery(&h, &cp, &ctx->s2);
   polyveck_invntt_tomont(&h);
   polyveck_sub(&w0, &w0, &h);
   polyveck_reduce(&w0);
@@ -160,7 +199,7 @@ rej:
     goto rej;
 
   /* Compute hints for w1 */
-  polyveck_pointwise_poly_montgomery(&h, &cp, &t0);
+  polyveck_pointwise_poly_montgomery(&h, &cp, &ctx->t0);
   polyveck_invntt_tomont(&h);
   polyveck_reduce(&h);
   if(polyveck_chknorm(&h, GAMMA2))
@@ -178,6 +217,40 @@ rej:
   return 0;
 }
 
+/*************************************************
+* Name:        crypto_sign_signature_ctx
+*
+* Description: Computes signature with a prepared secret key; output is
+*              identical to crypto_sign_signature on the original key.
+*
+* Arguments:   - const crypto_sign_ctx *ctx: pointer to signing context
+*                                            set up by crypto_sign_ctx_init
+*              - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*              - uint8_t *m:     pointer to message to be signed
+*              - size_t mlen:    length of message
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_signature_ctx(const crypto_sign_ctx *ctx,
+                              uint8_t *sig,
+                              size_t *siglen,
+                              const uint8_t *m,
+                              size_t mlen)
+{
+  uint8_t mu[CRHBYTES];
+  keccak_state state;
+
+  /* Compute CRH(tr, msg) */
+  shake256_init(&state);
+  shake256_absorb(&state, ctx->tr, CRHBYTES);
+  shake256_absorb(&state, m, mlen);
+  shake256_finalize(&state);
+  shake256_squeeze(mu, CRHBYTES, &state);
+
+  return sign_mu(ctx, sig, siglen, mu);
+}
+
 /*************************************************
 * Name:        crypto_sign
 *
@@ -210,63 +283,70 @@ int crypto_sign(uint8_t *sm,
 }
 
 /*************************************************
-* Name:        crypto_sign_verify
+* Name:        unpack_checked_sig
 *
-* Description: Verifies signature.
+* Description: Cheap checks done before any work on the public key or the
+*              message: signature length, encoding and norm of z.
 *
-* Arguments:   - uint8_t *m: pointer to input signature
+* Arguments:   - uint8_t c[]: output challenge seed of length SEEDBYTES
+*              - polyvecl *z: pointer to output vector z
+*              - polyveck *h: pointer to output hint vector h
+*              - const uint8_t *sig: pointer to input signature
 *              - size_t siglen: length of signature
-*              - const uint8_t *m: pointer to message
-*              - size_t mlen: length of message
-*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if the signature is well-formed and -1 otherwise
+**************************************************/
+static int unpack_checked_sig(uint8_t c[SEEDBYTES],
+                              polyvecl *z,
+                              polyveck *h,
+                              const uint8_t *sig,
+                              size_t siglen)
+{
+  if(siglen != CRYPTO_BYTES)
+    return -1;
+  if(unpack_sig(c, z, h, sig))
+    return -1;
+  if(polyvecl_chknorm(z, GAMMA1 - BETA))
+    return -1;
+  return 0;
+}
+
+/*************************************************
+* Name:        verify_mu
+*
+* Description: Verifies a signature unpacked by unpack_checked_sig against
+*              the message representative mu = CRH(CRH(pk), msg); shared
+*              by the one-shot and the streaming verification functions.
+*
+* Arguments:   - const crypto_verify_ctx *ctx: pointer to verification context
+*              - const uint8_t c[]: challenge seed of length SEEDBYTES
+*              - polyvecl *z: pointer to vector z, overwritten
+*              - const polyveck *h: pointer to hint vector h
+*              - const uint8_t mu[]: message representative of length CRHBYTES
 *
 * Returns 0 if signature could be verified correctly and -1 otherwise
 **************************************************/
-int crypto_sign_verify(const uint8_t *sig,
-                       size_t siglen,
-                       const uint8_t *m,
-                       size_t mlen,
-                       const uint8_t *pk)
+static int verify_mu(const crypto_verify_ctx *ctx,
+                     const uint8_t c[SEEDBYTES],
+                     polyvecl *z,
+                     const polyveck *h,
+                     const uint8_t mu[CRHBYTES])
 {
   unsigned int i;
   uint8_t buf[K*POLYW1_PACKEDBYTES];
-  uint8_t rho[SEEDBYTES];
-  uint8_t mu[CRHBYTES];
-  uint8_t c[SEEDBYTES];
   uint8_t c2[SEEDBYTES];
   poly cp;
-  polyvecl mat[K], z;
-  polyveck t1, w1, h;
+  polyveck t1, w1;
   keccak_state state;
 
-  if(siglen != CRYPTO_BYTES)
-    return -1;
-
-  unpack_pk(rho, &t1, pk);
-  if(unpack_sig(c, &z, &h, sig))
-    return -1;
-  if(polyvecl_chknorm(&z, GAMMA1 - BETA))
-    return -1;
-
-  /* Compute CRH(CRH(rho, t1), msg) */
-  crh(mu, pk, CRYPTO_PUBLICKEYBYTES);
-  shake256_init(&state);
-  shake256_absorb(&state, mu, CRHBYTES);
-  shake256_absorb(&state, m, mlen);
-  shake256_finalize(&state);
-  shake256_squeeze(mu, CRHBYTES, &state);
-
   /* Matrix-vector multiplication; compute Az - c2^dt1 */
   poly_challenge(&cp, c);
-  polyvec_matrix_expand(mat, rho);
 
-  polyvecl_ntt(&z);
-  polyvec_matrix_pointwise_montgomery(&w1, mat, &z);
+  polyvecl_ntt(z);
+  polyvec_matrix_pointwise_montgomery(&w1, ctx->mat, z);
 
   poly_ntt(&cp);
-  polyveck_shiftl(&t1);
-  polyveck_ntt(&t1);
-  polyveck_pointwise_poly_montgomery(&t1, &cp, &t1);
+  polyveck_pointwise_poly_montgomery(&t1, &cp, &ctx->t1);
 
   polyveck_sub(&w1, &w1, &t1);
   polyveck_reduce(&w1);
@@ -274,7 +354,7 @@ int crypto_sign_verify(const uint8_t *sig,
 
   /* Reconstruct w1 */
   polyveck_caddq(&w1);
-  polyveck_use_hint(&w1, &w1, &h);
+  polyveck_use_hint(&w1, &w1, h);
   polyveck_pack_w1(buf, &w1);
 
   /* Call random oracle and verify challenge */
@@ -290,6 +370,129 @@ int crypto_sign_verify(const uint8_t *sig,
   return 0;
 }
 
+/*************************************************
+* Name:        verify_msg
+*
+* Description: Computes mu = CRH(CRH(pk), msg) and verifies a signature
+*              unpacked by unpack_checked_sig.
+*
+* Arguments:   - const crypto_verify_ctx *ctx: pointer to verification context
+*              - const uint8_t c[]: challenge seed of length SEEDBYTES
+*              - polyvecl *z: pointer to vector z, overwritten
+*              - const polyveck *h: pointer to hint vector h
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+static int verify_msg(const crypto_verify_ctx *ctx,
+                      const uint8_t c[SEEDBYTES],
+                      polyvecl *z,
+                      const polyveck *h,
+                      const uint8_t *m,
+                      size_t mlen)
+{
+  uint8_t mu[CRHBYTES];
+  keccak_state state;
+
+  /* Compute CRH(CRH(rho, t1), msg) */
+  shake256_init(&state);
+  shake256_absorb(&state, ctx->tr, CRHBYTES);
+  shake256_absorb(&state, m, mlen);
+  shake256_finalize(&state);
+  shake256_squeeze(mu, CRHBYTES, &state);
+
+  return verify_mu(ctx, c, z, h, mu);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify
+*
+* Description: Verifies signature.
+*
+* Arguments:   - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify(const uint8_t *sig,
+                       size_t siglen,
+                       const uint8_t *m,
+                       size_t mlen,
+                       const uint8_t *pk)
+{
+  uint8_t c[SEEDBYTES];
+  polyvecl z;
+  polyveck h;
+  crypto_verify_ctx ctx;
+
+  /* Reject malformed signatures before expanding the public key */
+  if(unpack_checked_sig(c, &z, &h, sig, siglen))
+    return -1;
+
+  crypto_sign_verify_ctx_init(&ctx, pk);
+  return verify_msg(&ctx, c, &z, &h, m, mlen);
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_ctx_init
+*
+* Description: Prepares a public key for repeated verification: expands
+*              the matrix A from rho, computes CRH(pk) and transforms
+*              t1*2^D to NTT domain.
+*
+* Arguments:   - crypto_verify_ctx *ctx: pointer to output verification context
+*              - const uint8_t *pk:      pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int crypto_sign_verify_ctx_init(crypto_verify_ctx *ctx, const uint8_t *pk)
+{
+  uint8_t rho[SEEDBYTES];
+
+  unpack_pk(rho, &ctx->t1, pk);
+  crh(ctx->tr, pk, CRYPTO_PUBLICKEYBYTES);
+
+  polyvec_matrix_expand(ctx->mat, rho);
+  polyveck_shiftl(&ctx->t1);
+  polyveck_ntt(&ctx->t1);
+  return 0;
+}
+
+/*************************************************
+* Name:        crypto_sign_verify_ctx
+*
+* Description: Verifies signature with a prepared public key; result is
+*              identical to crypto_sign_verify on the original key.
+*
+* Arguments:   - const crypto_verify_ctx *ctx: pointer to verification context
+*                                              set up by crypto_sign_verify_ctx_init
+*              - uint8_t *m: pointer to input signature
+*              - size_t siglen: length of signature
+*              - const uint8_t *m: pointer to message
+*              - size_t mlen: length of message
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int crypto_sign_verify_ctx(const crypto_verify_ctx *ctx,
+                           const uint8_t *sig,
+                           size_t siglen,
+                           const uint8_t *m,
+                           size_t mlen)
+{
+  uint8_t c[SEEDBYTES];
+  polyvecl z;
+  polyveck h;
+
+  if(unpack_checked_sig(c, &z, &h, sig, siglen))
+    return -1;
+
+  return verify_msg(ctx, c, &z, &h, m, mlen);
+}
+
 /*************************************************
 * Name:        crypto_sign_open
 *
@@ -333,3 +536,135 @@ badsig:
 
   return -1;
 }
+
+/*************************************************
+* Name:        dilithium_sign_init
+*
+* Description: Starts signing a message that is passed in chunks with
+*              dilithium_sign_update; prepares the secret key as
+*              crypto_sign_ctx_init does.
+*
+* Arguments:   - dilithium_sign_state *ctx: pointer to output signing state
+*              - const uint8_t *sk: pointer to bit-packed secret key
+*
+* Returns 0 (success)
+**************************************************/
+int dilithium_sign_init(dilithium_sign_state *ctx, const uint8_t *sk)
+{
+  crypto_sign_ctx_init(&ctx->key, sk);
+  shake256_init(&ctx->state);
+  shake256_absorb(&ctx->state, ctx->key.tr, CRHBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        dilithium_sign_update
+*
+* Description: Absorbs the next chunk of the message to be signed.
+*
+* Arguments:   - dilithium_sign_state *ctx: pointer to signing state
+*              - const uint8_t *chunk: pointer to message chunk
+*              - size_t len: length of chunk
+*
+* Returns 0 (success)
+**************************************************/
+int dilithium_sign_update(dilithium_sign_state *ctx,
+                          const uint8_t *chunk,
+                          size_t len)
+{
+  shake256_absorb(&ctx->state, chunk, len);
+  return 0;
+}
+
+/*************************************************
+* Name:        dilithium_sign_final
+*
+* Description: Computes the signature of the concatenation of all chunks;
+*              identical to crypto_sign_signature on the whole message.
+*              The state has to be initialized again before reuse.
+*
+* Arguments:   - dilithium_sign_state *ctx: pointer to signing state
+*              - uint8_t *sig:   pointer to output signature (of length CRYPTO_BYTES)
+*              - size_t *siglen: pointer to output length of signature
+*
+* Returns 0 (success)
+**************************************************/
+int dilithium_sign_final(dilithium_sign_state *ctx,
+                         uint8_t *sig,
+                         size_t *siglen)
+{
+  uint8_t mu[CRHBYTES];
+
+  shake256_finalize(&ctx->state);
+  shake256_squeeze(mu, CRHBYTES, &ctx->state);
+  return sign_mu(&ctx->key, sig, siglen, mu);
+}
+
+/*************************************************
+* Name:        dilithium_verify_init
+*
+* Description: Starts verifying a signature on a message that is passed in
+*              chunks with dilithium_verify_update; prepares the public key
+*              as crypto_sign_verify_ctx_init does.
+*
+* Arguments:   - dilithium_verify_state *ctx: pointer to output verification state
+*              - const uint8_t *pk: pointer to bit-packed public key
+*
+* Returns 0 (success)
+**************************************************/
+int dilithium_verify_init(dilithium_verify_state *ctx, const uint8_t *pk)
+{
+  crypto_sign_verify_ctx_init(&ctx->key, pk);
+  shake256_init(&ctx->state);
+  shake256_absorb(&ctx->state, ctx->key.tr, CRHBYTES);
+  return 0;
+}
+
+/*************************************************
+* Name:        dilithium_verify_update
+*
+* Description: Absorbs the next chunk of the signed message.
+*
+* Arguments:   - dilithium_verify_state *ctx: pointer to verification state
+*              - const uint8_t *chunk: pointer to message chunk
+*              - size_t len: length of chunk
+*
+* Returns 0 (success)
+**************************************************/
+int dilithium_verify_update(dilithium_verify_state *ctx,
+                            const uint8_t *chunk,
+                            size_t len)
+{
+  shake256_absorb(&ctx->state, chunk, len);
+  return 0;
+}
+
+/*************************************************
+* Name:        dilithium_verify_final
+*
+* Description: Verifies the signature on the concatenation of all chunks;
+*              same result as crypto_sign_verify on the whole message.
+*              The state has to be initialized again before reuse.
+*
+* Arguments:   - dilithium_verify_state *ctx: pointer to verification state
+*              - const uint8_t *sig: pointer to input signature
+*              - size_t siglen: length of signature
+*
+* Returns 0 if signature could be verified correctly and -1 otherwise
+**************************************************/
+int dilithium_verify_final(dilithium_verify_state *ctx,
+                           const uint8_t *sig,
+                           size_t siglen)
+{
+  uint8_t mu[CRHBYTES];
+  uint8_t c[SEEDBYTES];
+  polyvecl z;
+  polyveck h;
+
+  if(unpack_checked_sig(c, &z, &h, sig, siglen))
+    return -1;
+
+  shake256_finalize(&ctx->state);
+  shake256_squeeze(mu, CRHBYTES, &ctx->state);
+  return verify_mu(&ctx->key, c, &z, &h, mu);
+}
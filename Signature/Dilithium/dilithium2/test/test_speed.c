@@ -18,6 +18,8 @@ int main(void)
   uint8_t sk[CRYPTO_SECRETKEYBYTES];
   uint8_t sm[CRYPTO_BYTES + CRHBYTES];
   uint8_t seed[CRHBYTES] = {0};
+  crypto_sign_ctx ctx;
+  crypto_verify_ctx vctx;
   polyvecl mat[K];
   poly *a = &mat[0].vec[0];
   poly *b = &mat[0].vec[1];
@@ -77,11 +79,25 @@ int main(void)
   }
   print_results("Sign:", t, NTESTS);
 
+  crypto_sign_ctx_init(&ctx, sk);
+  for(i = 0; i < NTESTS; ++i) {
+    t[i] = cpucycles();
+    crypto_sign_signature_ctx(&ctx, sm, &smlen, sm, CRHBYTES);
+  }
+  print_results("Sign (ctx):", t, NTESTS);
+
   for(i = 0; i < NTESTS; ++i) {
     t[i] = cpucycles();
     crypto_sign_verify(sm, CRYPTO_BYTES, sm, CRHBYTES, pk);
   }
   print_results("Verify:", t, NTESTS);
 
+  crypto_sign_verify_ctx_init(&vctx, pk);
+  for(i = 0; i < NTESTS; ++i) {
+    t[i] = cpucycles();
+    crypto_sign_verify_ctx(&vctx, sm, CRYPTO_BYTES, sm, CRHBYTES);
+  }
+  print_results("Verify (ctx):", t, NTESTS);
+
   return 0;
 }
@@ -26,6 +26,17 @@
 #include <string.h>
 #include "aes256ctr.h"
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) \
+    && !defined(AES256CTR_NO_AESNI)
+#define AES256CTR_USE_AESNI
+#include <emmintrin.h>
+#include <wmmintrin.h>
+/* AES-NI functions are compiled for AES-NI independently of the global
+ * compiler flags and must only be called after cpu_has_aesni() */
+#define AESNI_TARGET __attribute__((target("aes,sse2")))
+#define cpu_has_aesni() __builtin_cpu_supports("aes")
+#endif
+
 static inline uint32_t br_dec32le(const uint8_t *src)
 {
 	return (uint32_t)src[0]
@@ -554,9 +565,129 @@ static void br_aes_ct64_ctr_run(uint64_t sk_exp[120], const uint8_t *iv, uint32_
 	}
 }
 
+#ifdef AES256CTR_USE_AESNI
+/*
+ * Hardware AES backend. The 15 round keys are stored in the first 240 bytes
+ * of sk_exp, and ivw keeps exactly the layout used by the bitsliced code:
+ * read as bytes it already is four consecutive counter blocks
+ * nonce || BE32(ctr), so both backends produce identical key streams.
+ */
+
+AESNI_TARGET
+static inline __m128i aesni_expand_step(__m128i k, __m128i t)
+{
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+  return _mm_xor_si128(k, t);
+}
+
+#define AESNI_EXPAND(i, rcon) do { \
+  rk[i] = aesni_expand_step(rk[(i)-2], \
+            _mm_shuffle_epi32(_mm_aeskeygenassist_si128(rk[(i)-1], rcon), 0xff)); \
+  if((i) < 14) \
+    rk[(i)+1] = aesni_expand_step(rk[(i)-1], \
+                  _mm_shuffle_epi32(_mm_aeskeygenassist_si128(rk[i], 0x00), 0xaa)); \
+} while(0)
+
+AESNI_TARGET
+static void aesni_keysched(uint64_t sk_exp[120], const uint8_t *key)
+{
+  unsigned int i;
+  __m128i rk[16];
+
+  rk[0] = _mm_loadu_si128((const __m128i *)key);
+  rk[1] = _mm_loadu_si128((const __m128i *)(key + 16));
+  AESNI_EXPAND( 2, 0x01);
+  AESNI_EXPAND( 4, 0x02);
+  AESNI_EXPAND( 6, 0x04);
+  AESNI_EXPAND( 8, 0x08);
+  AESNI_EXPAND(10, 0x10);
+  AESNI_EXPAND(12, 0x20);
+  AESNI_EXPAND(14, 0x40);
+
+  for(i = 0; i < 15; i++)
+    _mm_storeu_si128((__m128i *)sk_exp + i, rk[i]);
+}
+
+/* Encrypts nblocks4 groups of 4 counter blocks, advancing ivw accordingly */
+AESNI_TARGET
+static inline void aesni_ctr_blocks(uint8_t *out, const unsigned int nblocks4,
+                                    uint32_t ivw[16], const __m128i rk[15])
+{
+  unsigned int i, j;
+  __m128i b[8];
+
+  for(j = 0; j < nblocks4; j++) {
+    for(i = 0; i < 4; i++)
+      b[4*j+i] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)ivw + i), rk[0]);
+    inc4_be(ivw+3);
+    inc4_be(ivw+7);
+    inc4_be(ivw+11);
+    inc4_be(ivw+15);
+  }
+  for(i = 1; i < 14; i++)
+    for(j = 0; j < 4*nblocks4; j++)
+      b[j] = _mm_aesenc_si128(b[j], rk[i]);
+  for(j = 0; j < 4*nblocks4; j++)
+    _mm_storeu_si128((__m128i *)(out + 16*j), _mm_aesenclast_si128(b[j], rk[14]));
+}
+
+/* Same as nblocks calls of aes_ctr4x, two calls interleaved at a time */
+AESNI_TARGET
+static void aesni_ctr(uint8_t *out, size_t nblocks, uint32_t ivw[16],
+                      const uint64_t sk_exp[120])
+{
+  unsigned int i;
+  __m128i rk[15];
+
+  for(i = 0; i < 15; i++)
+    rk[i] = _mm_loadu_si128((const __m128i *)sk_exp + i);
+
+  while(nblocks >= 2) {
+    aesni_ctr_blocks(out, 2, ivw, rk);
+    out += 128;
+    nblocks -= 2;
+  }
+  if(nblocks)
+    aesni_ctr_blocks(out, 1, ivw, rk);
+}
+#endif
+
+static void aes256ctr_ivw_init(uint32_t ivw[16], const uint8_t *nonce, uint32_t cc)
+{
+  br_range_dec32le(ivw, 3, nonce);
+  memcpy(ivw +  4, ivw, 3 * sizeof(uint32_t));
+  memcpy(ivw +  8, ivw, 3 * sizeof(uint32_t));
+  memcpy(ivw + 12, ivw, 3 * sizeof(uint32_t));
+  ivw[ 3] = br_swap32(cc);
+  ivw[ 7] = br_swap32(cc + 1);
+  ivw[11] = br_swap32(cc + 2);
+  ivw[15] = br_swap32(cc + 3);
+}
+
 void aes256ctr_prf(uint8_t *out, size_t outlen, const uint8_t *key, const uint8_t *nonce)
 {
   uint64_t sk_exp[120];
+#ifdef AES256CTR_USE_AESNI
+  size_t i;
+  uint32_t ivw[16];
+  uint8_t tmp[64];
+
+  if(cpu_has_aesni()) {
+    aesni_keysched(sk_exp, key);
+    aes256ctr_ivw_init(ivw, nonce, 0);
+    aesni_ctr(out, outlen/64, ivw, sk_exp);
+    out += outlen & ~(size_t)63;
+    outlen &= 63;
+    if(outlen > 0) {
+      aesni_ctr(tmp, 1, ivw, sk_exp);
+      for(i=0;i<outlen;i++)
+        out[i] = tmp[i];
+    }
+    return;
+  }
+#endif
 
   br_aes_ct64_ctr_init(sk_exp, key);
   br_aes_ct64_ctr_run(sk_exp, nonce, 0, out, outlen);
@@ -564,20 +695,25 @@ void aes256ctr_prf(uint8_t *out, size_t outlen, const uint8_t *key, const uint8_
 
 void aes256ctr_init(aes256ctr_ctx *s, const uint8_t *key, const uint8_t *nonce)
 {
+#ifdef AES256CTR_USE_AESNI
+  if(cpu_has_aesni())
+    aesni_keysched(s->sk_exp, key);
+  else
+#endif
   br_aes_ct64_ctr_init(s->sk_exp, key);
 
-  br_range_dec32le(s->ivw, 3, nonce);
-  memcpy(s->ivw +  4, s->ivw, 3 * sizeof(uint32_t));
-  memcpy(s->ivw +  8, s->ivw, 3 * sizeof(uint32_t));
-  memcpy(s->ivw + 12, s->ivw, 3 * sizeof(uint32_t));
-  s->ivw[ 3] = br_swap32(0);
-  s->ivw[ 7] = br_swap32(1);
-  s->ivw[11] = br_swap32(2);
-  s->ivw[15] = br_swap32(3);
+  aes256ctr_ivw_init(s->ivw, nonce, 0);
 }
 
 void aes256ctr_squeezeblocks(uint8_t *out, size_t nblocks, aes256ctr_ctx *s)
 {
+#ifdef AES256CTR_USE_AESNI
+  if(cpu_has_aesni()) {
+    aesni_ctr(out, nblocks, s->ivw, s->sk_exp);
+    return;
+  }
+#endif
+
   while (nblocks > 0) {
     aes_ctr4x(out, s->ivw, s->sk_exp);
     out += 64;
@@ -4,10 +4,27 @@
 #include <stdint.h>
 #include "params.h"
 
+#define zetas DILITHIUM_NAMESPACE(_zetas)
+extern const int32_t zetas[N];
+
 #define ntt DILITHIUM_NAMESPACE(_ntt)
 void ntt(int32_t a[N]);
 
 #define invntt_tomont DILITHIUM_NAMESPACE(_invntt_tomont)
 void invntt_tomont(int32_t a[N]);
 
+#ifdef DILITHIUM_USE_AVX2
+#define ntt_avx2 DILITHIUM_NAMESPACE(_ntt_avx2)
+void ntt_avx2(int32_t a[N]);
+
+#define invntt_tomont_avx2 DILITHIUM_NAMESPACE(_invntt_tomont_avx2)
+void invntt_tomont_avx2(int32_t a[N]);
+
+#define pointwise_avx2 DILITHIUM_NAMESPACE(_pointwise_avx2)
+void pointwise_avx2(int32_t c[N], const int32_t a[N], const int32_t b[N]);
+
+#define pointwise_acc_avx2 DILITHIUM_NAMESPACE(_pointwise_acc_avx2)
+void pointwise_acc_avx2(int32_t c[N], const int32_t a[N], const int32_t b[N]);
+#endif
+
 #endif
@@ -0,0 +1,294 @@
+#include <immintrin.h>
+#include <stdint.h>
+#include "params.h"
+#include "cpufeatures.h"
+#include "ntt.h"
+#include "reduce.h"
+
+#ifdef DILITHIUM_USE_AVX2
+
+/*
+ * 8-lane counterparts of ntt, invntt_tomont and the pointwise products.
+ * Every lane performs the same 32-bit additions and the same 64-bit
+ * Montgomery reduction as the scalar code, and reductions stay as lazy as in
+ * the reference (none between layers), so the results are bit-identical.
+ *
+ * The five outer layers (len >= 8) pair whole registers. The three inner
+ * layers work on 16 coefficients held in two registers, regrouped by
+ * shuffle4, shuffle2 and shuffle1 so that one register holds the lower and
+ * the other the upper butterfly inputs; their per-lane twiddle factors are
+ * gathered from zetas with permutes.
+ */
+
+/*************************************************
+* Name:        montgomery_mul_avx2
+*
+* Description: Lane-wise multiplication followed by Montgomery reduction;
+*              equivalent to montgomery_reduce((int64_t)a*b) in every lane
+*
+* Arguments:   - __m256i a: first factors
+*              - __m256i b: second factors
+*
+* Returns integers congruent to a*b*2^{-32} mod Q
+**************************************************/
+AVX2_TARGET
+static inline __m256i montgomery_mul_avx2(__m256i a, __m256i b)
+{
+  const __m256i q = _mm256_set1_epi32(Q);
+  const __m256i qinv = _mm256_set1_epi32(QINV);
+  __m256i p0, p1, t0, t1;
+
+  /* 64-bit products of the even and of the odd lanes */
+  p0 = _mm256_mul_epi32(a, b);
+  p1 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+
+  t0 = _mm256_mul_epi32(p0, qinv);
+  t1 = _mm256_mul_epi32(p1, qinv);
+  t0 = _mm256_mul_epi32(t0, q);
+  t1 = _mm256_mul_epi32(t1, q);
+
+  /* The low halves cancel, the high halves are the results */
+  p0 = _mm256_sub_epi64(p0, t0);
+  p1 = _mm256_sub_epi64(p1, t1);
+  return _mm256_blend_epi32(_mm256_srli_epi64(p0, 32), p1, 0xAA);
+}
+
+/*************************************************
+* Name:        shuffle4
+*
+* Description: Regroup two registers of 8 coefficients so that a holds the
+*              lower and b the upper inputs of the len = 4 butterflies; the
+*              operation is its own inverse
+**************************************************/
+AVX2_TARGET
+static inline void shuffle4(__m256i *a, __m256i *b)
+{
+  __m256i t = _mm256_permute2x128_si256(*a, *b, 0x20);
+  *b = _mm256_permute2x128_si256(*a, *b, 0x31);
+  *a = t;
+}
+
+/*************************************************
+* Name:        shuffle2
+*
+* Description: Same as shuffle4 for the len = 2 butterflies, applied to the
+*              output of shuffle4
+**************************************************/
+AVX2_TARGET
+static inline void shuffle2(__m256i *a, __m256i *b)
+{
+  __m256i t = _mm256_unpacklo_epi64(*a, *b);
+  *b = _mm256_unpackhi_epi64(*a, *b);
+  *a = t;
+}
+
+/*************************************************
+* Name:        shuffle1
+*
+* Description: Same as shuffle4 for the len = 1 butterflies, applied to the
+*              output of shuffle2
+**************************************************/
+AVX2_TARGET
+static inline void shuffle1(__m256i *a, __m256i *b)
+{
+  __m256i t = _mm256_blend_epi32(*a, _mm256_slli_epi64(*b, 32), 0xAA);
+  *b = _mm256_blend_epi32(_mm256_srli_epi64(*a, 32), *b, 0xAA);
+  *a = t;
+}
+
+/*************************************************
+* Name:        butterfly_avx2
+*
+* Description: Cooley-Tukey butterflies of ntt on 8 lanes
+**************************************************/
+AVX2_TARGET
+static inline void butterfly_avx2(__m256i *a, __m256i *b, __m256i zeta)
+{
+  __m256i t = montgomery_mul_avx2(zeta, *b);
+  *b = _mm256_sub_epi32(*a, t);
+  *a = _mm256_add_epi32(*a, t);
+}
+
+/*************************************************
+* Name:        butterfly_inv_avx2
+*
+* Description: Gentleman-Sande butterflies of invntt_tomont on 8 lanes
+**************************************************/
+AVX2_TARGET
+static inline void butterfly_inv_avx2(__m256i *a, __m256i *b, __m256i zeta)
+{
+  __m256i t = *a;
+  *a = _mm256_add_epi32(t, *b);
+  *b = _mm256_sub_epi32(t, *b);
+  *b = montgomery_mul_avx2(zeta, *b);
+}
+
+/*************************************************
+* Name:        ntt_avx2
+*
+* Description: Forward NTT, in-place; same output as ntt.
+*
+* Arguments:   - int32_t a[N]: input/output coefficient array
+**************************************************/
+AVX2_TARGET
+void ntt_avx2(int32_t a[N])
+{
+  unsigned int len, start, j, k;
+  __m256i zeta, x, y;
+
+  k = 0;
+  for(len = 128; len >= 8; len >>= 1) {
+    for(start = 0; start < N; start += 2*len) {
+      zeta = _mm256_set1_epi32(zetas[++k]);
+      for(j = start; j < start + len; j += 8) {
+        x = _mm256_loadu_si256((const __m256i *)&a[j]);
+        y = _mm256_loadu_si256((const __m256i *)&a[j + len]);
+        butterfly_avx2(&x, &y, zeta);
+        _mm256_storeu_si256((__m256i *)&a[j], x);
+        _mm256_storeu_si256((__m256i *)&a[j + len], y);
+      }
+    }
+  }
+
+  /* k = 31: blocks of 16 coefficients use zetas[32+2i..], [64+4i..] and [128+8i..] */
+  for(j = 0; j < N/16; ++j) {
+    x = _mm256_loadu_si256((const __m256i *)&a[16*j]);
+    y = _mm256_loadu_si256((const __m256i *)&a[16*j + 8]);
+
+    shuffle4(&x, &y);
+    zeta = _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)&zetas[32 + 2*j]));
+    zeta = _mm256_permutevar8x32_epi32(zeta, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1));
+    butterfly_avx2(&x, &y, zeta);
+
+    shuffle2(&x, &y);
+    zeta = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)&zetas[64 + 4*j]));
+    zeta = _mm256_permutevar8x32_epi32(zeta, _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3));
+    butterfly_avx2(&x, &y, zeta);
+
+    shuffle1(&x, &y);
+    zeta = _mm256_loadu_si256((const __m256i *)&zetas[128 + 8*j]);
+    butterfly_avx2(&x, &y, zeta);
+
+    shuffle1(&x, &y);
+    shuffle2(&x, &y);
+    shuffle4(&x, &y);
+    _mm256_storeu_si256((__m256i *)&a[16*j], x);
+    _mm256_storeu_si256((__m256i *)&a[16*j + 8], y);
+  }
+}
+
+/*************************************************
+* Name:        invntt_tomont_avx2
+*
+* Description: Inverse NTT and multiplication by Montgomery factor 2^32,
+*              in-place; same output as invntt_tomont.
+*
+* Arguments:   - int32_t a[N]: input/output coefficient array
+**************************************************/
+AVX2_TARGET
+void invntt_tomont_avx2(int32_t a[N])
+{
+  unsigned int len, start, j, k;
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i f = _mm256_set1_epi32(41978); // mont^2/256
+  __m256i zeta, x, y;
+
+  /* The inner layers use -zetas[255-8i..], -zetas[127-4i..] and -zetas[63-2i..] in decreasing order */
+  for(j = 0; j < N/16; ++j) {
+    x = _mm256_loadu_si256((const __m256i *)&a[16*j]);
+    y = _mm256_loadu_si256((const __m256i *)&a[16*j + 8]);
+
+    shuffle4(&x, &y);
+    shuffle2(&x, &y);
+    shuffle1(&x, &y);
+    zeta = _mm256_loadu_si256((const __m256i *)&zetas[248 - 8*j]);
+    zeta = _mm256_permutevar8x32_epi32(zeta, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    butterfly_inv_avx2(&x, &y, _mm256_sub_epi32(zero, zeta));
+
+    shuffle1(&x, &y);
+    zeta = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)&zetas[124 - 4*j]));
+    zeta = _mm256_permutevar8x32_epi32(zeta, _mm256_setr_epi32(3, 3, 2, 2, 1, 1, 0, 0));
+    butterfly_inv_avx2(&x, &y, _mm256_sub_epi32(zero, zeta));
+
+    shuffle2(&x, &y);
+    zeta = _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)&zetas[62 - 2*j]));
+    zeta = _mm256_permutevar8x32_epi32(zeta, _mm256_setr_epi32(1, 1, 1, 1, 0, 0, 0, 0));
+    butterfly_inv_avx2(&x, &y, _mm256_sub_epi32(zero, zeta));
+
+    shuffle4(&x, &y);
+    _mm256_storeu_si256((__m256i *)&a[16*j], x);
+    _mm256_storeu_si256((__m256i *)&a[16*j + 8], y);
+  }
+
+  k = 32;
+  for(len = 8; len < N; len <<= 1) {
+    for(start = 0; start < N; start += 2*len) {
+      zeta = _mm256_set1_epi32(-zetas[--k]);
+      for(j = start; j < start + len; j += 8) {
+        x = _mm256_loadu_si256((const __m256i *)&a[j]);
+        y = _mm256_loadu_si256((const __m256i *)&a[j + len]);
+        butterfly_inv_avx2(&x, &y, zeta);
+        _mm256_storeu_si256((__m256i *)&a[j], x);
+        _mm256_storeu_si256((__m256i *)&a[j + len], y);
+      }
+    }
+  }
+
+  for(j = 0; j < N; j += 8) {
+    x = _mm256_loadu_si256((const __m256i *)&a[j]);
+    _mm256_storeu_si256((__m256i *)&a[j], montgomery_mul_avx2(f, x));
+  }
+}
+
+/*************************************************
+* Name:        pointwise_avx2
+*
+* Description: Pointwise multiplication in NTT domain followed by
+*              multiplication by 2^{-32}; same output as the loop of
+*              poly_pointwise_montgomery.
+*
+* Arguments:   - int32_t c[N]: output coefficients
+*              - const int32_t a[N]: first input
+*              - const int32_t b[N]: second input
+**************************************************/
+AVX2_TARGET
+void pointwise_avx2(int32_t c[N], const int32_t a[N], const int32_t b[N])
+{
+  unsigned int i;
+  __m256i x, y;
+
+  for(i = 0; i < N; i += 8) {
+    x = _mm256_loadu_si256((const __m256i *)&a[i]);
+    y = _mm256_loadu_si256((const __m256i *)&b[i]);
+    _mm256_storeu_si256((__m256i *)&c[i], montgomery_mul_avx2(x, y));
+  }
+}
+
+/*************************************************
+* Name:        pointwise_acc_avx2
+*
+* Description: Pointwise multiplication of polynomials in NTT domain,
+*              multiplication by 2^{-32} and addition of the result to c;
+*              replaces a poly_pointwise_montgomery into a temporary
+*              followed by poly_add.
+*
+* Arguments:   - int32_t c[N]: input/output coefficients
+*              - const int32_t a[N]: first input polynomial
+*              - const int32_t b[N]: second input polynomial
+**************************************************/
+AVX2_TARGET
+void pointwise_acc_avx2(int32_t c[N], const int32_t a[N], const int32_t b[N])
+{
+  unsigned int i;
+  __m256i x, y, z;
+
+  for(i = 0; i < N; i += 8) {
+    x = _mm256_loadu_si256((const __m256i *)&a[i]);
+    y = _mm256_loadu_si256((const __m256i *)&b[i]);
+    z = _mm256_loadu_si256((const __m256i *)&c[i]);
+    z = _mm256_add_epi32(z, montgomery_mul_avx2(x, y));
+    _mm256_storeu_si256((__m256i *)&c[i], z);
+  }
+}
+
+#endif
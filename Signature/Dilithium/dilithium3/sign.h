@@ -6,6 +6,8 @@
 #include "params.h"
 #include "polyvec.h"
 #include "poly.h"
+#include "cpufeatures.h"
+#include "fips202.h"
 
 #define challenge DILITHIUM_NAMESPACE(_challenge)
 void challenge(poly *c, const uint8_t seed[SEEDBYTES]);
@@ -18,6 +20,25 @@ int crypto_sign_signature(uint8_t *sig, size_t *siglen,
                           const uint8_t *m, size_t mlen,
                           const uint8_t *sk);
 
+/* Secret key prepared once for repeated signing, see crypto_sign_ctx_init.
+ * Every poly is 1 KiB, so aligning mat aligns all polynomials. */
+typedef struct {
+  polyvecl mat[K] VECTOR_ALIGN;   /* expanded matrix A */
+  polyvecl s1;                    /* s1 in NTT domain */
+  polyveck s2;                    /* s2 in NTT domain */
+  polyveck t0;                    /* t0 in NTT domain */
+  uint8_t tr[CRHBYTES];
+  uint8_t key[SEEDBYTES];
+} crypto_sign_ctx;
+
+#define crypto_sign_ctx_init DILITHIUM_NAMESPACE(_ctx_init)
+int crypto_sign_ctx_init(crypto_sign_ctx *ctx, const uint8_t *sk);
+
+#define crypto_sign_signature_ctx DILITHIUM_NAMESPACE(_signature_ctx)
+int crypto_sign_signature_ctx(const crypto_sign_ctx *ctx,
+                              uint8_t *sig, size_t *siglen,
+                              const uint8_t *m, size_t mlen);
+
 #define crypto_sign DILITHIUM_NAMESPACE()
 int crypto_sign(uint8_t *sm, size_t *smlen,
                 const uint8_t *m, size_t mlen,
@@ -28,9 +49,59 @@ int crypto_sign_verify(const uint8_t *sig, size_t siglen,
                        const uint8_t *m, size_t mlen,
                        const uint8_t *pk);
 
+/* Public key prepared once for repeated verification, see
+ * crypto_sign_verify_ctx_init */
+typedef struct {
+  polyvecl mat[K] VECTOR_ALIGN;   /* expanded matrix A */
+  polyveck t1;                    /* t1*2^D in NTT domain */
+  uint8_t tr[CRHBYTES];           /* CRH(pk) */
+} crypto_verify_ctx;
+
+#define crypto_sign_verify_ctx_init DILITHIUM_NAMESPACE(_verify_ctx_init)
+int crypto_sign_verify_ctx_init(crypto_verify_ctx *ctx, const uint8_t *pk);
+
+#define crypto_sign_verify_ctx DILITHIUM_NAMESPACE(_verify_ctx)
+int crypto_sign_verify_ctx(const crypto_verify_ctx *ctx,
+                           const uint8_t *sig, size_t siglen,
+                           const uint8_t *m, size_t mlen);
+
 #define crypto_sign_open DILITHIUM_NAMESPACE(_open)
 int crypto_sign_open(uint8_t *m, size_t *mlen,
                      const uint8_t *sm, size_t smlen,
                      const uint8_t *pk);
 
+/* Signing of a message passed in chunks, see dilithium_sign_init */
+typedef struct {
+  crypto_sign_ctx key;
+  keccak_state state;             /* SHAKE256 absorbing tr|msg */
+} dilithium_sign_state;
+
+#define dilithium_sign_init DILITHIUM_NAMESPACE(_sign_init)
+int dilithium_sign_init(dilithium_sign_state *ctx, const uint8_t *sk);
+
+#define dilithium_sign_update DILITHIUM_NAMESPACE(_sign_update)
+int dilithium_sign_update(dilithium_sign_state *ctx,
+                          const uint8_t *chunk, size_t len);
+
+#define dilithium_sign_final DILITHIUM_NAMESPACE(_sign_final)
+int dilithium_sign_final(dilithium_sign_state *ctx,
+                         uint8_t *sig, size_t *siglen);
+
+/* Verification of a message passed in chunks, see dilithium_verify_init */
+typedef struct {
+  crypto_verify_ctx key;
+  keccak_state state;             /* SHAKE256 absorbing CRH(pk)|msg */
+} dilithium_verify_state;
+
+#define dilithium_verify_init DILITHIUM_NAMESPACE(_verify_init)
+int dilithium_verify_init(dilithium_verify_state *ctx, const uint8_t *pk);
+
+#define dilithium_verify_update DILITHIUM_NAMESPACE(_verify_update)
+int dilithium_verify_update(dilithium_verify_state *ctx,
+                            const uint8_t *chunk, size_t len);
+
+#define dilithium_verify_final DILITHIUM_NAMESPACE(_verify_final)
+int dilithium_verify_final(dilithium_verify_state *ctx,
+                           const uint8_t *sig, size_t siglen);
+
 #endif
@@ -60,6 +60,11 @@ void dilithium_shake256_stream_init(keccak_state *state,
 #define stream256_squeezeblocks(OUT, OUTBLOCKS, STATE) \
         shake256_squeezeblocks(OUT, OUTBLOCKS, STATE)
 
+#ifdef DILITHIUM_USE_AVX2
+/* The SHAKE streams can also be expanded four at a time with fips202x4 */
+#define DILITHIUM_USE_SHAKEX4
+#endif
+
 #endif
 
 #endif
@@ -6,4 +6,12 @@
 #define CRYPTO_ALGNAME "Dilithium5"
 #define DILITHIUM_NAMESPACE(s) pqcrystals_dilithium5_ref##s
 
+/* Build the AVX2 code paths (taken at run time on CPUs with AVX2) when the
+ * compiler supports x86 target attributes; define DILITHIUM_NO_AVX2 to
+ * build the reference code only */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) \
+    && !defined(DILITHIUM_NO_AVX2)
+#define DILITHIUM_USE_AVX2
+#endif
+
 #endif
@@ -5,6 +5,13 @@
 #include "reduce.h"
 #include "rounding.h"
 #include "symmetric.h"
+#include "cpufeatures.h"
+#ifdef DILITHIUM_USE_AVX2
+#include "rejsample_avx2.h"
+#endif
+#ifdef DILITHIUM_USE_SHAKEX4
+#include "fips202x4.h"
+#endif
 
 #ifdef DBENCH
 #include "test/cpucycles.h"
@@ -140,6 +147,11 @@ void poly_shiftl(poly *a) {
 void poly_ntt(poly *a) {
   DBENCH_START();
 
+#ifdef DILITHIUM_USE_AVX2
+  if(cpu_has_avx2())
+    ntt_avx2(a->coeffs);
+  else
+#endif
   ntt(a->coeffs);
 
   DBENCH_STOP(*tmul);
@@ -157,6 +169,11 @@ void poly_ntt(poly *a) {
 void poly_invntt_tomont(poly *a) {
   DBENCH_START();
 
+#ifdef DILITHIUM_USE_AVX2
+  if(cpu_has_avx2())
+    invntt_tomont_avx2(a->coeffs);
+  else
+#endif
   invntt_tomont(a->coeffs);
 
   DBENCH_STOP(*tmul);
@@ -177,6 +194,11 @@ void poly_pointwise_montgomery(poly *c, const poly *a, const poly *b) {
   unsigned int i;
   DBENCH_START();
 
+#ifdef DILITHIUM_USE_AVX2
+  if(cpu_has_avx2())
+    pointwise_avx2(c->coeffs, a->coeffs, b->coeffs);
+  else
+#endif
   for(i = 0; i < N; ++i)
     c->coeffs[i] = montgomery_reduce((int64_t)a->coeffs[i] * b->coeffs[i]);
 
@@ -334,6 +356,10 @@ static unsigned int rej_uniform(int32_t *a,
   DBENCH_START();
 
   ctr = pos = 0;
+#ifdef DILITHIUM_USE_AVX2
+  if(cpu_has_avx2())
+    ctr = rej_uniform_avx2(a, len, buf, buflen, &pos);
+#endif
   while(ctr < len && pos + 3 <= buflen) {
     t  = buf[pos++];
     t |= (uint32_t)buf[pos++] << 8;
@@ -498,6 +524,174 @@ void poly_uniform_gamma1(poly *a,
   polyz_unpack(a, buf);
 }
 
+#ifdef DILITHIUM_USE_SHAKEX4
+/*************************************************
+* Name:        xof_input
+*
+* Description: Writes seed|nonce, the input of the SHAKE streams, to in.
+*
+* Arguments:   - uint8_t *in: output buffer of seedlen + 2 bytes
+*              - const uint8_t *seed: byte array with seed of length seedlen
+*              - size_t seedlen: length of the seed
+*              - uint16_t nonce: 2-byte nonce
+**************************************************/
+static void xof_input(uint8_t *in,
+                      const uint8_t *seed,
+                      size_t seedlen,
+                      uint16_t nonce)
+{
+  size_t i;
+
+  for(i = 0; i < seedlen; ++i)
+    in[i] = seed[i];
+  in[seedlen] = nonce;
+  in[seedlen + 1] = nonce >> 8;
+}
+
+/*************************************************
+* Name:        poly_uniform_4x
+*
+* Description: Four poly_uniform calls with the same seed, computing the
+*              SHAKE128 streams in parallel with the AVX2 Keccak. Every
+*              polynomial is identical to the one of the scalar function.
+*              Only call after cpu_has_avx2().
+*
+* Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+*              - const uint8_t seed[]: byte array with seed of length SEEDBYTES
+*              - uint16_t nonce0, ..., nonce3: 2-byte nonces
+**************************************************/
+void poly_uniform_4x(poly *a0,
+                     poly *a1,
+                     poly *a2,
+                     poly *a3,
+                     const uint8_t seed[SEEDBYTES],
+                     uint16_t nonce0,
+                     uint16_t nonce1,
+                     uint16_t nonce2,
+                     uint16_t nonce3)
+{
+  unsigned int i, j, off, ctr[4];
+  unsigned int buflen = POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES;
+  uint8_t buf[4][POLY_UNIFORM_NBLOCKS*STREAM128_BLOCKBYTES + 2];
+  uint8_t in[4][SEEDBYTES + 2];
+  poly *a[4] = {a0, a1, a2, a3};
+  keccakx4_state state;
+
+  xof_input(in[0], seed, SEEDBYTES, nonce0);
+  xof_input(in[1], seed, SEEDBYTES, nonce1);
+  xof_input(in[2], seed, SEEDBYTES, nonce2);
+  xof_input(in[3], seed, SEEDBYTES, nonce3);
+  shake128x4_absorb(&state, in[0], in[1], in[2], in[3], SEEDBYTES + 2);
+  shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                           POLY_UNIFORM_NBLOCKS, &state);
+
+  for(j = 0; j < 4; ++j)
+    ctr[j] = rej_uniform(a[j]->coeffs, N, buf[j], buflen);
+
+  while(ctr[0] < N || ctr[1] < N || ctr[2] < N || ctr[3] < N) {
+    off = buflen % 3;
+    for(j = 0; j < 4; ++j)
+      for(i = 0; i < off; ++i)
+        buf[j][i] = buf[j][buflen - off + i];
+
+    shake128x4_squeezeblocks(buf[0] + off, buf[1] + off, buf[2] + off,
+                             buf[3] + off, 1, &state);
+    buflen = STREAM128_BLOCKBYTES + off;
+    for(j = 0; j < 4; ++j)
+      if(ctr[j] < N)
+        ctr[j] += rej_uniform(a[j]->coeffs + ctr[j], N - ctr[j], buf[j], buflen);
+  }
+}
+
+/*************************************************
+* Name:        poly_uniform_eta_4x
+*
+* Description: Four poly_uniform_eta calls with the same seed, computing
+*              the SHAKE128 streams in parallel with the AVX2 Keccak. Every
+*              polynomial is identical to the one of the scalar function.
+*              Only call after cpu_has_avx2().
+*
+* Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+*              - const uint8_t seed[]: byte array with seed of length SEEDBYTES
+*              - uint16_t nonce0, ..., nonce3: 2-byte nonces
+**************************************************/
+void poly_uniform_eta_4x(poly *a0,
+                         poly *a1,
+                         poly *a2,
+                         poly *a3,
+                         const uint8_t seed[SEEDBYTES],
+                         uint16_t nonce0,
+                         uint16_t nonce1,
+                         uint16_t nonce2,
+                         uint16_t nonce3)
+{
+  unsigned int j, ctr[4];
+  unsigned int buflen = POLY_UNIFORM_ETA_NBLOCKS*STREAM128_BLOCKBYTES;
+  uint8_t buf[4][POLY_UNIFORM_ETA_NBLOCKS*STREAM128_BLOCKBYTES];
+  uint8_t in[4][SEEDBYTES + 2];
+  poly *a[4] = {a0, a1, a2, a3};
+  keccakx4_state state;
+
+  xof_input(in[0], seed, SEEDBYTES, nonce0);
+  xof_input(in[1], seed, SEEDBYTES, nonce1);
+  xof_input(in[2], seed, SEEDBYTES, nonce2);
+  xof_input(in[3], seed, SEEDBYTES, nonce3);
+  shake128x4_absorb(&state, in[0], in[1], in[2], in[3], SEEDBYTES + 2);
+  shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                           POLY_UNIFORM_ETA_NBLOCKS, &state);
+
+  for(j = 0; j < 4; ++j)
+    ctr[j] = rej_eta(a[j]->coeffs, N, buf[j], buflen);
+
+  while(ctr[0] < N || ctr[1] < N || ctr[2] < N || ctr[3] < N) {
+    shake128x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3], 1, &state);
+    for(j = 0; j < 4; ++j)
+      if(ctr[j] < N)
+        ctr[j] += rej_eta(a[j]->coeffs + ctr[j], N - ctr[j], buf[j],
+                          STREAM128_BLOCKBYTES);
+  }
+}
+
+/*************************************************
+* Name:        poly_uniform_gamma1_4x
+*
+* Description: Four poly_uniform_gamma1 calls with the same seed, computing
+*              the SHAKE256 streams in parallel with the AVX2 Keccak. Every
+*              polynomial is identical to the one of the scalar function.
+*              Only call after cpu_has_avx2().
+*
+* Arguments:   - poly *a0, ..., *a3: pointers to output polynomials
+*              - const uint8_t seed[]: byte array with seed of length CRHBYTES
+*              - uint16_t nonce0, ..., nonce3: 16-bit nonces
+**************************************************/
+void poly_uniform_gamma1_4x(poly *a0,
+                            poly *a1,
+                            poly *a2,
+                            poly *a3,
+                            const uint8_t seed[CRHBYTES],
+                            uint16_t nonce0,
+                            uint16_t nonce1,
+                            uint16_t nonce2,
+                            uint16_t nonce3)
+{
+  uint8_t buf[4][POLY_UNIFORM_GAMMA1_NBLOCKS*STREAM256_BLOCKBYTES];
+  uint8_t in[4][CRHBYTES + 2];
+  keccakx4_state state;
+
+  xof_input(in[0], seed, CRHBYTES, nonce0);
+  xof_input(in[1], seed, CRHBYTES, nonce1);
+  xof_input(in[2], seed, CRHBYTES, nonce2);
+  xof_input(in[3], seed, CRHBYTES, nonce3);
+  shake256x4_absorb(&state, in[0], in[1], in[2], in[3], CRHBYTES + 2);
+  shake256x4_squeezeblocks(buf[0], buf[1], buf[2], buf[3],
+                           POLY_UNIFORM_GAMMA1_NBLOCKS, &state);
+  polyz_unpack(a0, buf[0]);
+  polyz_unpack(a1, buf[1]);
+  polyz_unpack(a2, buf[2]);
+  polyz_unpack(a3, buf[3]);
+}
+#endif
+
 /*************************************************
 * Name:        challenge
 *
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include "params.h"
+#include "symmetric.h"
 
 typedef struct {
   int32_t coeffs[N];
@@ -52,6 +53,39 @@ void poly_uniform_eta(poly *a,
 void poly_uniform_gamma1(poly *a,
                          const uint8_t seed[CRHBYTES],
                          uint16_t nonce);
+
+#ifdef DILITHIUM_USE_SHAKEX4
+#define poly_uniform_4x DILITHIUM_NAMESPACE(_poly_uniform_4x)
+void poly_uniform_4x(poly *a0,
+                     poly *a1,
+                     poly *a2,
+                     poly *a3,
+                     const uint8_t seed[SEEDBYTES],
+                     uint16_t nonce0,
+                     uint16_t nonce1,
+                     uint16_t nonce2,
+                     uint16_t nonce3);
+#define poly_uniform_eta_4x DILITHIUM_NAMESPACE(_poly_uniform_eta_4x)
+void poly_uniform_eta_4x(poly *a0,
+                         poly *a1,
+                         poly *a2,
+                         poly *a3,
+                         const uint8_t seed[SEEDBYTES],
+                         uint16_t nonce0,
+                         uint16_t nonce1,
+                         uint16_t nonce2,
+                         uint16_t nonce3);
+#define poly_uniform_gamma1_4x DILITHIUM_NAMESPACE(_poly_uniform_gamma1_4x)
+void poly_uniform_gamma1_4x(poly *a0,
+                            poly *a1,
+                            poly *a2,
+                            poly *a3,
+                            const uint8_t seed[CRHBYTES],
+                            uint16_t nonce0,
+                            uint16_t nonce1,
+                            uint16_t nonce2,
+                            uint16_t nonce3);
+#endif
 #define poly_challenge DILITHIUM_NAMESPACE(_poly_challenge)
 void poly_challenge(poly *c, const uint8_t seed[SEEDBYTES]);
 
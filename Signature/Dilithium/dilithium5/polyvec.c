@@ -2,6 +2,54 @@
 #include "params.h"
 #include "polyvec.h"
 #include "poly.h"
+#include "ntt.h"
+#include "cpufeatures.h"
+
+#ifdef DILITHIUM_USE_SHAKEX4
+typedef void (*poly_sampler)(poly *, const uint8_t *, uint16_t);
+typedef void (*poly_sampler_4x)(poly *, poly *, poly *, poly *,
+                                const uint8_t *,
+                                uint16_t, uint16_t, uint16_t, uint16_t);
+
+/*************************************************
+* Name:        poly_sample_4x
+*
+* Description: Samples n polynomials from the same seed, four at a time
+*              with sample_4x. A single remaining polynomial is sampled
+*              with the scalar sample; two or three are padded to a
+*              four-way call with scratch outputs.
+*
+* Arguments:   - poly *a[]: pointers to the n output polynomials
+*              - const uint16_t nonce[]: nonces of the n polynomials
+*              - unsigned int n: number of polynomials
+*              - const uint8_t *seed: seed shared by all polynomials
+*              - poly_sampler sample: scalar sampler
+*              - poly_sampler_4x sample_4x: four-way sampler
+**************************************************/
+static void poly_sample_4x(poly *a[],
+                           const uint16_t nonce[],
+                           unsigned int n,
+                           const uint8_t *seed,
+                           poly_sampler sample,
+                           poly_sampler_4x sample_4x)
+{
+  unsigned int i;
+  poly t[2];
+
+  for(i = 0; i + 4 <= n; i += 4)
+    sample_4x(a[i], a[i+1], a[i+2], a[i+3], seed,
+              nonce[i], nonce[i+1], nonce[i+2], nonce[i+3]);
+
+  if(n - i == 1)
+    sample(a[i], seed, nonce[i]);
+  else if(n - i == 2)
+    sample_4x(a[i], a[i+1], &t[0], &t[1], seed,
+              nonce[i], nonce[i+1], nonce[i], nonce[i]);
+  else if(n - i == 3)
+    sample_4x(a[i], a[i+1], a[i+2], &t[0], seed,
+              nonce[i], nonce[i+1], nonce[i+2], nonce[i]);
+}
+#endif
 
 /*************************************************
 * Name:        expand_mat
@@ -17,6 +65,20 @@
 void polyvec_matrix_expand(polyvecl mat[K], const uint8_t rho[SEEDBYTES]) {
   unsigned int i, j;
 
+#ifdef DILITHIUM_USE_SHAKEX4
+  if(cpu_has_avx2()) {
+    poly *a[K*L];
+    uint16_t nonce[K*L];
+
+    for(i = 0; i < K; ++i)
+      for(j = 0; j < L; ++j) {
+        a[i*L + j] = &mat[i].vec[j];
+        nonce[i*L + j] = (i << 8) + j;
+      }
+    poly_sample_4x(a, nonce, K*L, rho, poly_uniform, poly_uniform_4x);
+    return;
+  }
+#endif
   for(i = 0; i < K; ++i)
     for(j = 0; j < L; ++j)
       poly_uniform(&mat[i].vec[j], rho, (i << 8) + j);
@@ -36,6 +98,19 @@ void polyvec_matrix_pointwise_montgomery(polyveck *t, const polyvecl mat[K], con
 void polyvecl_uniform_eta(polyvecl *v, const uint8_t seed[SEEDBYTES], uint16_t nonce) {
   unsigned int i;
 
+#ifdef DILITHIUM_USE_SHAKEX4
+  if(cpu_has_avx2()) {
+    poly *a[L];
+    uint16_t nonces[L];
+
+    for(i = 0; i < L; ++i) {
+      a[i] = &v->vec[i];
+      nonces[i] = nonce + i;
+    }
+    poly_sample_4x(a, nonces, L, seed, poly_uniform_eta, poly_uniform_eta_4x);
+    return;
+  }
+#endif
   for(i = 0; i < L; ++i)
     poly_uniform_eta(&v->vec[i], seed, nonce++);
 }
@@ -43,6 +118,19 @@ void polyvecl_uniform_eta(polyvecl *v, const uint8_t seed[SEEDBYTES], uint16_t n
 void polyvecl_uniform_gamma1(polyvecl *v, const uint8_t seed[SEEDBYTES], uint16_t nonce) {
   unsigned int i;
 
+#ifdef DILITHIUM_USE_SHAKEX4
+  if(cpu_has_avx2()) {
+    poly *a[L];
+    uint16_t nonces[L];
+
+    for(i = 0; i < L; ++i) {
+      a[i] = &v->vec[i];
+      nonces[i] = L*nonce + i;
+    }
+    poly_sample_4x(a, nonces, L, seed, poly_uniform_gamma1, poly_uniform_gamma1_4x);
+    return;
+  }
+#endif
   for(i = 0; i < L; ++i)
     poly_uniform_gamma1(&v->vec[i], seed, L*nonce + i);
 }
@@ -133,6 +221,14 @@ void polyvecl_pointwise_acc_montgomery(poly *w,
   unsigned int i;
   poly t;
 
+#ifdef DILITHIUM_USE_AVX2
+  if(cpu_has_avx2()) {
+    pointwise_avx2(w->coeffs, u->vec[0].coeffs, v->vec[0].coeffs);
+    for(i = 1; i < L; ++i)
+      pointwise_acc_avx2(w->coeffs, u->vec[i].coeffs, v->vec[i].coeffs);
+    return;
+  }
+#endif
   poly_pointwise_montgomery(w, &u->vec[0], &v->vec[0]);
   for(i = 1; i < L; ++i) {
     poly_pointwise_montgomery(&t, &u->vec[i], &v->vec[i]);
@@ -169,6 +265,19 @@ int polyvecl_chknorm(const polyvecl *v, int32_t bound)  {
 void polyveck_uniform_eta(polyveck *v, const uint8_t seed[SEEDBYTES], uint16_t nonce) {
   unsigned int i;
 
+#ifdef DILITHIUM_USE_SHAKEX4
+  if(cpu_has_avx2()) {
+    poly *a[K];
+    uint16_t nonces[K];
+
+    for(i = 0; i < K; ++i) {
+      a[i] = &v->vec[i];
+      nonces[i] = nonce + i;
+    }
+    poly_sample_4x(a, nonces, K, seed, poly_uniform_eta, poly_uniform_eta_4x);
+    return;
+  }
+#endif
   for(i = 0; i < K; ++i)
     poly_uniform_eta(&v->vec[i], seed, nonce++);
 }
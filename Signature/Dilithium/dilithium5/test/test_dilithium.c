@@ -11,12 +11,15 @@ int main(void)
 {
   unsigned int i, j;
   int ret;
-  size_t mlen, smlen;
+  size_t mlen, smlen, siglen;
   uint8_t m[MLEN] = {0};
   uint8_t sm[MLEN + CRYPTO_BYTES];
   uint8_t m2[MLEN + CRYPTO_BYTES];
+  uint8_t sig[CRYPTO_BYTES];
   uint8_t pk[CRYPTO_PUBLICKEYBYTES];
   uint8_t sk[CRYPTO_SECRETKEYBYTES];
+  dilithium_sign_state sst;
+  dilithium_verify_state vst;
 
   for(i = 0; i < NTESTS; ++i) {
     randombytes(m, MLEN);
@@ -42,6 +45,29 @@ int main(void)
       }
     }
 
+    /* Streaming API with the message split at a random position */
+    randombytes((uint8_t *)&j, sizeof(j));
+    j %= MLEN + 1;
+    dilithium_sign_init(&sst, sk);
+    dilithium_sign_update(&sst, m, j);
+    dilithium_sign_update(&sst, m + j, MLEN - j);
+    dilithium_sign_final(&sst, sig, &siglen);
+#ifndef DILITHIUM_RANDOMIZED_SIGNING
+    for(j = 0; j < CRYPTO_BYTES; ++j) {
+      if(sig[j] != sm[j]) {
+        fprintf(stderr, "Streaming signature doesn't match\n");
+        return -1;
+      }
+    }
+#endif
+    dilithium_verify_init(&vst, pk);
+    dilithium_verify_update(&vst, m, MLEN/2);
+    dilithium_verify_update(&vst, m + MLEN/2, MLEN - MLEN/2);
+    if(dilithium_verify_final(&vst, sig, siglen)) {
+      fprintf(stderr, "Streaming verification failed\n");
+      return -1;
+    }
+
     randombytes((uint8_t *)&j, sizeof(j));
     do {
       randombytes(m2, 1);
@@ -52,6 +78,12 @@ int main(void)
       fprintf(stderr, "Trivial forgeries possible\n");
       return -1;
     }
+    dilithium_verify_init(&vst, pk);
+    dilithium_verify_update(&vst, sm + CRYPTO_BYTES, MLEN);
+    if(!dilithium_verify_final(&vst, sm, CRYPTO_BYTES)) {
+      fprintf(stderr, "Trivial forgeries possible (streaming)\n");
+      return -1;
+    }
   }
 
   printf("CRYPTO_PUBLICKEYBYTES = %d\n", CRYPTO_PUBLICKEYBYTES);